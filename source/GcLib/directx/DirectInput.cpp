@@ -578,62 +578,112 @@ KeyReplayManager::KeyReplayManager(VirtualKeyManager* input) {
 }
 KeyReplayManager::~KeyReplayManager() {}
 void KeyReplayManager::AddTarget(int16_t key) {
-	mapKeyTarget_[key] = KEY_FREE;
+	mapKeyTarget_[key];
 }
 void KeyReplayManager::Update() {
 	if (state_ == STATE_RECORD) {
 		for (auto itrTarget = mapKeyTarget_.begin(); itrTarget != mapKeyTarget_.end(); ++itrTarget) {
-			int16_t idKey = itrTarget->first;
-			DIKeyState keyState = input_->GetVirtualKeyState(idKey);
-			
-			if (frame_ == 0 || itrTarget->second != keyState) {
-				ReplayData data;
-				data.id_ = idKey;
-				data.frame_ = frame_;
-				data.state_ = keyState;
-				listReplayData_.push_back(data);
+			KeyStream& stream = itrTarget->second;
+			DIKeyState keyState = input_->GetVirtualKeyState(itrTarget->first);
+
+			if (frame_ == 0 || stream.state_ != keyState) {
+				stream.listFrame_.push_back(frame_);
+				stream.listState_.push_back((uint8_t)keyState);
 			}
 
-			itrTarget->second = keyState;
+			stream.state_ = keyState;
 		}
 	}
 	else if (state_ == STATE_REPLAY) {
-		if (frame_ == 0) replayDataIterator_ = listReplayData_.begin();
 		for (auto itrTarget = mapKeyTarget_.begin(); itrTarget != mapKeyTarget_.end(); ++itrTarget) {
-			int16_t idKey = itrTarget->first;
-			DIKeyState& stateKey = itrTarget->second;
-
-			for (auto itrData = replayDataIterator_; itrData != listReplayData_.end(); ++itrData) {
-				ReplayData& data = *itrData;
-				if (data.frame_ > frame_) break;
+			KeyStream& stream = itrTarget->second;
 
-				if (idKey == data.id_ && data.frame_ == frame_) {
-					stateKey = data.state_;
-					++replayDataIterator_;
-				}
+			size_t countChange = stream.listFrame_.size();
+			while (stream.pos_ < countChange && stream.listFrame_[stream.pos_] <= frame_) {
+				stream.state_ = (DIKeyState)stream.listState_[stream.pos_];
+				++stream.pos_;
 			}
 
-			ref_count_ptr<VirtualKey> key = input_->GetVirtualKey(idKey);
-			key->SetKeyState(stateKey);
+			ref_count_ptr<VirtualKey> key = input_->GetVirtualKey(itrTarget->first);
+			if (key) key->SetKeyState(stream.state_);
 		}
-
-		if (frame_ % 600 == 0)
-			listReplayData_.erase(listReplayData_.begin(), replayDataIterator_);
 	}
 	++frame_;
 }
+void KeyReplayManager::Seek(uint32_t frame) {
+	//Positions every stream so that the next Update replays the given frame
+	for (auto itrTarget = mapKeyTarget_.begin(); itrTarget != mapKeyTarget_.end(); ++itrTarget)
+		itrTarget->second.Seek(frame);
+	frame_ = frame;
+}
 bool KeyReplayManager::IsTargetKeyCode(int16_t key) {
 	bool res = false;
 	for (auto itrTarget = mapKeyTarget_.begin(); itrTarget != mapKeyTarget_.end(); ++itrTarget) {
 		ref_count_ptr<VirtualKey> vKey = input_->GetVirtualKey(itrTarget->first);
-		if (key == vKey->GetKeyCode()) {
+		if (vKey && key == vKey->GetKeyCode()) {
 			res = true;
 			break;
 		}
 	}
 	return res;
 }
+
+static void _WriteVarUInt(ByteBuffer& buffer, uint32_t val) {
+	while (val >= 0x80) {
+		buffer.WriteValue<uint8_t>((uint8_t)(val | 0x80));
+		val >>= 7;
+	}
+	buffer.WriteValue<uint8_t>((uint8_t)val);
+}
+static uint32_t _ReadVarUInt(ByteBuffer& buffer) {
+	uint32_t res = 0;
+	for (size_t shift = 0; shift < 32; shift += 7) {
+		uint8_t byte = buffer.ReadValue<uint8_t>();
+		res |= (uint32_t)(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0) break;
+	}
+	return res;
+}
+
 void KeyReplayManager::ReadRecord(RecordBuffer& record) {
+	for (auto itrTarget = mapKeyTarget_.begin(); itrTarget != mapKeyTarget_.end(); ++itrTarget)
+		itrTarget->second = KeyStream();
+
+	uint32_t format = record.GetRecordAs<uint32_t>("format", FORMAT_LEGACY);
+	if (format == FORMAT_LEGACY) {
+		_ReadRecordLegacy(record);
+	}
+	else {
+		uint32_t countStream = record.GetRecordAs<uint32_t>("streamCount");
+
+		ByteBuffer buffer;
+		buffer.SetSize(record.GetEntrySize("stream"));
+		record.GetRecord("stream", buffer.GetPointer(), buffer.GetSize());
+
+		//Stream layout: [id : int16] [count : uint32] count * ([frame delta : varint] [state : uint8])
+		for (uint32_t iStream = 0; iStream < countStream; ++iStream) {
+			int16_t idKey = buffer.ReadValue<int16_t>();
+			uint32_t countChange = buffer.ReadValue<uint32_t>();
+
+			//Keys added with AddTarget partway through the replay are not registered yet, keep their streams too
+			KeyStream& stream = mapKeyTarget_[idKey];
+			stream.listFrame_.resize(countChange);
+			stream.listState_.resize(countChange);
+
+			uint32_t frame = 0;
+			for (uint32_t iChange = 0; iChange < countChange; ++iChange) {
+				frame += _ReadVarUInt(buffer);
+				stream.listFrame_[iChange] = frame;
+				stream.listState_[iChange] = buffer.ReadValue<uint8_t>();
+			}
+		}
+	}
+
+	for (auto itrTarget = mapKeyTarget_.begin(); itrTarget != mapKeyTarget_.end(); ++itrTarget)
+		itrTarget->second.BuildIndex();
+	frame_ = 0;
+}
+void KeyReplayManager::_ReadRecordLegacy(RecordBuffer& record) {
 	size_t countReplayData = record.GetRecordAs<uint32_t>("count");
 
 	ByteBuffer buffer;
@@ -642,18 +692,60 @@ void KeyReplayManager::ReadRecord(RecordBuffer& record) {
 	for (size_t iRec = 0; iRec < countReplayData; ++iRec) {
 		ReplayData data;
 		buffer.Read(&data, sizeof(ReplayData));
-		listReplayData_.push_back(data);
+
+		KeyStream& stream = mapKeyTarget_[data.id_];
+		stream.listFrame_.push_back(data.frame_);
+		stream.listState_.push_back((uint8_t)data.state_);
 	}
 }
 void KeyReplayManager::WriteRecord(RecordBuffer& record) {
-	record.SetRecord<uint32_t>("count", listReplayData_.size());
+	record.SetRecord<uint32_t>("format", FORMAT_KEY_STREAM);
+	record.SetRecord<uint32_t>("streamCount", mapKeyTarget_.size());
 
 	ByteBuffer buffer;
-	for (auto itrData = listReplayData_.begin(); itrData != listReplayData_.end(); ++itrData) {
-		ReplayData& data = *itrData;
-		buffer.Write(&data, sizeof(ReplayData));
+	for (auto itrTarget = mapKeyTarget_.begin(); itrTarget != mapKeyTarget_.end(); ++itrTarget) {
+		KeyStream& stream = itrTarget->second;
+		uint32_t countChange = stream.listFrame_.size();
+
+		buffer.WriteValue<int16_t>(itrTarget->first);
+		buffer.WriteValue<uint32_t>(countChange);
+
+		uint32_t framePrev = 0;
+		for (uint32_t iChange = 0; iChange < countChange; ++iChange) {
+			uint32_t frame = stream.listFrame_[iChange];
+			_WriteVarUInt(buffer, frame - framePrev);
+			buffer.WriteValue<uint8_t>(stream.listState_[iChange]);
+			framePrev = frame;
+		}
 	}
-	record.SetRecord("data", buffer.GetPointer(), buffer.GetSize());
+	record.SetRecord("stream", buffer.GetPointer(), buffer.GetSize());
 }
 
+//KeyReplayManager::KeyStream
+void KeyReplayManager::KeyStream::BuildIndex() {
+	listIndex_.clear();
+	if (listFrame_.size() == 0) return;
+
+	uint32_t countIndex = listFrame_.back() / INDEX_INTERVAL + 1;
+	listIndex_.resize(countIndex);
+
+	size_t pos = 0;
+	for (uint32_t iIndex = 0; iIndex < countIndex; ++iIndex) {
+		uint32_t frame = iIndex * INDEX_INTERVAL;
+		while (pos < listFrame_.size() && listFrame_[pos] < frame)
+			++pos;
+		listIndex_[iIndex] = pos;
+	}
+}
+void KeyReplayManager::KeyStream::Seek(uint32_t frame) {
+	//Finds the first change after the target frame, the key holds the state of the change before it
+	size_t countChange = listFrame_.size();
+	size_t index = frame / INDEX_INTERVAL;
+
+	pos_ = index < listIndex_.size() ? listIndex_[index] : countChange;
+	while (pos_ < countChange && listFrame_[pos_] < frame)
+		++pos_;
+
+	state_ = pos_ > 0 ? (DIKeyState)listState_[pos_ - 1] : KEY_FREE;
+}
 #endif
\ No newline at end of file
@@ -201,6 +201,13 @@ namespace directx {
 			STATE_RECORD,
 			STATE_REPLAY,
 		};
+
+		enum : uint32_t {
+			FORMAT_LEGACY = 0,		//Flat list of (id, frame, state)
+			FORMAT_KEY_STREAM = 2,	//Per-key streams of delta-encoded state changes
+
+			INDEX_INTERVAL = 60,	//Frames per seek index entry
+		};
 	protected:
 #pragma pack(push, 2)
 		struct ReplayData {
@@ -210,14 +217,26 @@ namespace directx {
 		};
 #pragma pack(pop)
 
+		//State changes of a single key, in frame order
+		struct KeyStream {
+			DIKeyState state_ = KEY_FREE;
+			std::vector<uint32_t> listFrame_;
+			std::vector<uint8_t> listState_;
+
+			size_t pos_ = 0;						//Next change to be replayed
+			std::vector<uint32_t> listIndex_;		//First change at or after each INDEX_INTERVAL frames
+
+			void BuildIndex();
+			void Seek(uint32_t frame);
+		};
+
 		int state_;
 		uint32_t frame_;
 
-		std::list<ReplayData>::iterator replayDataIterator_;
-		std::map<int16_t, DIKeyState> mapKeyTarget_;
-
-		std::list<ReplayData> listReplayData_;
+		std::map<int16_t, KeyStream> mapKeyTarget_;
 		VirtualKeyManager* input_;
+
+		void _ReadRecordLegacy(gstd::RecordBuffer& record);
 	public:
 		KeyReplayManager(VirtualKeyManager* input);
 		virtual ~KeyReplayManager();
@@ -227,6 +246,9 @@ namespace directx {
 		bool IsTargetKeyCode(int16_t key);
 
 		void Update();
+		void Seek(uint32_t frame);
+		uint32_t GetFrame() { return frame_; }
+
 		void ReadRecord(gstd::RecordBuffer& record);
 		void WriteRecord(gstd::RecordBuffer& record);
 	};
@@ -17,6 +17,8 @@ DirectSoundManager::DirectSoundManager() {
 	pDirectSound_ = nullptr;
 	pDirectSoundPrimaryBuffer_ = nullptr;
 
+	sizeOggDecodeMax_ = 1024 * 1024;
+
 	CreateSoundDivision(SoundDivision::DIVISION_BGM);
 	CreateSoundDivision(SoundDivision::DIVISION_SE);
 	CreateSoundDivision(SoundDivision::DIVISION_VOICE);
@@ -25,6 +27,15 @@ DirectSoundManager::~DirectSoundManager() {
 	Logger::WriteTop("DirectSound: Finalizing.");
 	this->Clear();
 
+	for (auto& worker : listStreamingWorker_)
+		worker->Stop();
+	signalStream_.SetSignal();
+	for (auto& worker : listStreamingWorker_) {
+		signalStream_.SetSignal();
+		worker->Join();
+	}
+	listStreamingWorker_.clear();
+
 	threadManage_->Stop();
 	threadManage_->Join();
 	threadManage_ = nullptr;
@@ -87,6 +98,12 @@ bool DirectSoundManager::Initialize(HWND hWnd) {
 	threadManage_.reset(new SoundManageThread(this));
 	threadManage_->Start();
 
+	//Streaming workers, shared by all streaming players to refill their buffers
+	for (size_t iWorker = 0; iWorker < STREAMING_WORKER_COUNT; ++iWorker) {
+		listStreamingWorker_.push_back(unique_ptr<StreamingWorker>(new StreamingWorker(this)));
+		listStreamingWorker_.back()->Start();
+	}
+
 	Logger::WriteTop("DirectSound: Initialized.");
 
 	thisBase_ = this;
@@ -315,28 +332,44 @@ void DirectSoundManager::SetFadeDeleteAll() {
 	catch (...) {}
 }
 
+static bool _CompareStreamRequest(const DirectSoundManager::StreamRequest& a, const DirectSoundManager::StreamRequest& b) {
+	return a.timeDeadline > b.timeDeadline;
+}
+void DirectSoundManager::RequestStream(const StreamRequest& request) {
+	{
+		Lock lock(lockStream_);
+		listStreamRequest_.push_back(request);
+		std::push_heap(listStreamRequest_.begin(), listStreamRequest_.end(), _CompareStreamRequest);
+	}
+	signalStream_.SetSignal();
+}
+
 //DirectSoundManager::SoundManageThread
 DirectSoundManager::SoundManageThread::SoundManageThread(DirectSoundManager* manager) {
 	_SetOuter(manager);
 	timeCurrent_ = 0;
-	timePrevious_ = 0;
+	timeLastArrange_ = 0;
 }
 void DirectSoundManager::SoundManageThread::_Run() {
 	DirectSoundManager* manager = _GetOuter();
 	while (this->GetStatus() == RUN) {
 		timeCurrent_ = SystemUtility::GetCpuTime2();
 
+		bool bArrange = timeCurrent_ - timeLastArrange_ >= INTERVAL_ARRANGE;
 		{
 			Lock lock(manager->GetLock());
 			_Fade();
-			_Arrange();
+			if (bArrange)
+				_Arrange();
 		}
 
-		if (manager->panelInfo_ != nullptr && this->GetStatus() == RUN)
-			manager->panelInfo_->Update(manager);
-		
-		timePrevious_ = timeCurrent_;
-		::Sleep(100);
+		if (bArrange) {
+			if (manager->panelInfo_ != nullptr && this->GetStatus() == RUN)
+				manager->panelInfo_->Update(manager);
+			timeLastArrange_ = timeCurrent_;
+		}
+
+		::Sleep(INTERVAL_FADE);
 	}
 }
 void DirectSoundManager::SoundManageThread::_Arrange() {
@@ -388,24 +421,54 @@ void DirectSoundManager::SoundManageThread::_Arrange() {
 }
 void DirectSoundManager::SoundManageThread::_Fade() {
 	DirectSoundManager* manager = _GetOuter();
-	uint64_t timeGap = timeCurrent_ - timePrevious_;
 
 	auto* listPlayer = &manager->listManagedPlayer_;
 	for (auto itrPlayer = listPlayer->begin(); itrPlayer != listPlayer->end(); ++itrPlayer) {
 		SoundPlayer* player = itrPlayer->get();
 		if (player == nullptr) continue;
 
-		double rateFade = player->GetFadeVolumeRate();
-		if (rateFade == 0) continue;
+		player->_UpdateFade(timeCurrent_);
+	}
+}
 
-		double rateVolume = player->GetVolumeRate();
-		rateFade *= timeGap / 1000.0;
-		rateVolume += rateFade;
-		player->SetVolumeRate(rateVolume);
+//DirectSoundManager::StreamingWorker
+DirectSoundManager::StreamingWorker::StreamingWorker(DirectSoundManager* manager) {
+	_SetOuter(manager);
+}
+void DirectSoundManager::StreamingWorker::_Run() {
+	DirectSoundManager* manager = _GetOuter();
+	auto& listRequest = manager->listStreamRequest_;
 
-		if (rateVolume <= 0 && player->bFadeDelete_) {
-			player->Stop();
-			player->Delete();
+	while (this->GetStatus() == RUN) {
+		StreamRequest request;
+		DWORD timeWait = INTERVAL_IDLE;
+		bool bHasRequest = false;
+		{
+			Lock lock(manager->lockStream_);
+			if (listRequest.size() > 0) {
+				uint64_t time = SystemUtility::GetCpuTime2();
+				uint64_t timeDeadline = listRequest.front().timeDeadline;
+				if (timeDeadline <= time) {
+					std::pop_heap(listRequest.begin(), listRequest.end(), _CompareStreamRequest);
+					request = std::move(listRequest.back());
+					listRequest.pop_back();
+					bHasRequest = true;
+				}
+				else timeWait = std::min<uint64_t>(timeDeadline - time, INTERVAL_IDLE);
+			}
+		}
+
+		if (!bHasRequest) {
+			manager->signalStream_.Wait(timeWait);
+			continue;
+		}
+
+		if (shared_ptr<SoundStreamingPlayer> player = request.player.lock()) {
+			uint64_t timeNext = player->_ServiceStream(request.idStream, SystemUtility::GetCpuTime2());
+			if (timeNext > 0) {
+				request.timeDeadline = timeNext;
+				manager->RequestStream(request);
+			}
 		}
 	}
 }
@@ -632,13 +695,28 @@ ov_callbacks SoundSourceDataOgg::oggCallBacks_ = {
 	SoundSourceDataOgg::_CloseOgg,
 	SoundSourceDataOgg::_TellOgg,
 };
+ov_callbacks SoundSourceDataOgg::oggCallBacksMemory_ = {
+	SoundSourceDataOgg::_ReadOggMemory,
+	SoundSourceDataOgg::_SeekOggMemory,
+	SoundSourceDataOgg::_CloseOgg,
+	SoundSourceDataOgg::_TellOggMemory,
+};
 SoundSourceDataOgg::SoundSourceDataOgg() {
 	fileOgg_ = nullptr;
+	bDecoded_ = false;
 }
 SoundSourceDataOgg::~SoundSourceDataOgg() {
 	Release();
 }
 void SoundSourceDataOgg::Release() {
+	if (threadDecode_) {
+		threadDecode_->Stop();
+		threadDecode_->Join();
+		threadDecode_ = nullptr;
+	}
+	bDecoded_ = false;
+	bufDecoded_.Clear();
+
 	SoundSourceData::Release();
 
 	if (fileOgg_) {
@@ -674,6 +752,21 @@ bool SoundSourceDataOgg::Load(shared_ptr<gstd::FileReader> reader) {
 
 		QWORD pcmTotal = ov_pcm_total(fileOgg_, -1);
 		audioSizeTotal_ = pcmTotal * formatWave_.nBlockAlign;
+
+		//Short files get decoded once in the background, players stream from the file until it finishes
+		DirectSoundManager* soundManager = DirectSoundManager::GetBase();
+		if (soundManager && audioSizeTotal_ > 0 && audioSizeTotal_ <= soundManager->GetOggDecodeThreshold()) {
+			threadDecode_.reset(new DecodeThread(this));
+
+			ByteBuffer& bufFile = threadDecode_->bufFile_;
+			size_t posPrev = reader->GetFilePointer();
+			bufFile.SetSize(reader->GetFileSize());
+			reader->SetFilePointerBegin();
+			reader->Read(bufFile.GetPointer(), bufFile.GetSize());
+			reader->Seek(posPrev);
+
+			threadDecode_->Start();
+		}
 	}
 	catch (bool) {
 		return false;
@@ -724,6 +817,67 @@ long SoundSourceDataOgg::_TellOgg(void* source) {
 	SoundSourceDataOgg* parent = (SoundSourceDataOgg*)source;
 	return parent->reader_->GetFilePointer();
 }
+size_t SoundSourceDataOgg::_ReadOggMemory(void* ptr, size_t size, size_t nmemb, void* source) {
+	ByteBuffer* buffer = (ByteBuffer*)source;
+	if (size == 0) return 0;
+	return buffer->Read(ptr, size * nmemb) / size;
+}
+int SoundSourceDataOgg::_SeekOggMemory(void* source, ogg_int64_t offset, int whence) {
+	ByteBuffer* buffer = (ByteBuffer*)source;
+	switch (whence) {
+	case SEEK_CUR:
+		offset += buffer->GetOffset();
+		break;
+	case SEEK_END:
+		offset += buffer->GetSize();
+		break;
+	}
+	if (offset < 0) return -1;
+	buffer->Seek(offset);
+	return 0;
+}
+long SoundSourceDataOgg::_TellOggMemory(void* source) {
+	ByteBuffer* buffer = (ByteBuffer*)source;
+	return buffer->GetOffset();
+}
+
+//SoundSourceDataOgg::DecodeThread
+SoundSourceDataOgg::DecodeThread::DecodeThread(SoundSourceDataOgg* source) {
+	_SetOuter(source);
+}
+void SoundSourceDataOgg::DecodeThread::_Run() {
+	SoundSourceDataOgg* source = _GetOuter();
+
+	OggVorbis_File fileOgg;
+	if (ov_open_callbacks((void*)&bufFile_, &fileOgg, nullptr, 0, oggCallBacksMemory_) < 0)
+		return;
+
+	ByteBuffer& bufPcm = source->bufDecoded_;
+	size_t sizeTotal = source->audioSizeTotal_;
+	bufPcm.SetSize(sizeTotal);
+
+	size_t written = 0;
+	while (written < sizeTotal && this->GetStatus() == RUN) {
+		int remain = std::min<size_t>(sizeTotal - written, 0x1000);
+		long read = ov_read(&fileOgg, bufPcm.GetPointer(written), remain, 0, 2, 1, nullptr);
+		if (read == OV_HOLE) continue;
+		if (read <= 0) break;
+		written += read;
+	}
+	ov_clear(&fileOgg);
+
+	if (this->GetStatus() != RUN) {
+		bufPcm.Clear();
+		return;
+	}
+
+	//Truncated or damaged streams play the rest as silence, same as the streaming path
+	if (written < sizeTotal)
+		memset(bufPcm.GetPointer(written), 0, sizeTotal - written);
+	bufFile_.Clear();
+
+	source->bDecoded_ = true;
+}
 
 //*******************************************************************
 //SoundPlayer
@@ -746,6 +900,10 @@ SoundPlayer::SoundPlayer() {
 	rateVolume_ = 100.0;
 	rateVolumeFadePerSec_ = 0;
 
+	timeFadeBase_ = 0;
+	rateVolumeFadeBase_ = 0;
+	rateVolumeFadeLast_ = 0;
+
 	bPause_ = false;
 
 	division_ = nullptr;
@@ -838,6 +996,10 @@ void SoundPlayer::SetFade(double rateVolumeFadePerSec) {
 	{
 		Lock lock(lock_);
 		rateVolumeFadePerSec_ = rateVolumeFadePerSec;
+
+		timeFadeBase_ = SystemUtility::GetCpuTime2();
+		rateVolumeFadeBase_ = rateVolume_;
+		rateVolumeFadeLast_ = rateVolume_;
 	}
 }
 void SoundPlayer::SetFadeDelete(double rateVolumeFadePerSec) {
@@ -847,6 +1009,27 @@ void SoundPlayer::SetFadeDelete(double rateVolumeFadePerSec) {
 		SetFade(rateVolumeFadePerSec);
 	}
 }
+void SoundPlayer::_UpdateFade(uint64_t time) {
+	{
+		Lock lock(lock_);
+		if (rateVolumeFadePerSec_ == 0) return;
+
+		//Volume was set from elsewhere mid-fade, continue the envelope from there
+		if (rateVolume_ != rateVolumeFadeLast_) {
+			timeFadeBase_ = time;
+			rateVolumeFadeBase_ = rateVolume_;
+		}
+
+		double timeElapsed = time > timeFadeBase_ ? (time - timeFadeBase_) / 1000.0 : 0.0;
+		SetVolumeRate(rateVolumeFadeBase_ + rateVolumeFadePerSec_ * timeElapsed);
+		rateVolumeFadeLast_ = rateVolume_;
+
+		if (rateVolume_ <= 0 && bFadeDelete_) {
+			Stop();
+			Delete();
+		}
+	}
+}
 LONG SoundPlayer::_GetVolumeAsDirectSoundDecibel(float rate) {
 	LONG result = 0;
 	if (rate >= 1.0f) {
@@ -1033,9 +1216,9 @@ bool SoundPlayer::GetSamplesFFT(DWORD durationMs, size_t resolution, bool bAutoL
 //SoundStreamingPlayer
 //*******************************************************************
 SoundStreamingPlayer::SoundStreamingPlayer() {
-	pDirectSoundNotify_ = nullptr;
-	ZeroMemory(hEvent_, sizeof(HANDLE) * 3);
-	thread_.reset(new StreamingThread(this));
+	bPlaying_ = false;
+	idStream_ = 0;
+	indexPlayingLast_ = -1;
 
 	bStreaming_ = true;
 	bStreamOver_ = false;
@@ -1048,28 +1231,35 @@ SoundStreamingPlayer::SoundStreamingPlayer() {
 }
 SoundStreamingPlayer::~SoundStreamingPlayer() {
 	this->Stop();
-
-	for (size_t iEvent = 0; iEvent < 3; ++iEvent)
-		::CloseHandle(hEvent_[iEvent]);
-	ptr_release(pDirectSoundNotify_);
 }
-void SoundStreamingPlayer::_CreateSoundEvent(WAVEFORMATEX& formatWave) {
+void SoundStreamingPlayer::_InitializeStream(WAVEFORMATEX& formatWave) {
+	//The buffer is split into two halves of sizeCopy_ bytes,
+	//	one half is refilled by the streaming workers while the other one plays
 	sizeCopy_ = formatWave.nAvgBytesPerSec;
+}
+uint64_t SoundStreamingPlayer::_ServiceStream(uint64_t idStream, uint64_t time) {
+	if (pDirectSoundBuffer_ == nullptr) return 0;
+	{
+		Lock lock(lock_);
+		if (idStream != idStream_ || !bPlaying_) return 0;
+
+		DWORD point = 0;
+		if (FAILED(pDirectSoundBuffer_->GetCurrentPosition(&point, nullptr)))
+			return time + STREAM_POLL_MAX;
+
+		//The cursor moved on to the other half, refill the one it just left
+		int indexPlaying = point < sizeCopy_ ? 0 : 1;
+		if (indexPlaying != indexPlayingLast_) {
+			_CopyStream(indexPlaying ^ 1);
+			indexPlayingLast_ = indexPlaying;
+			if (!bPlaying_) return 0;
+		}
 
-	HRESULT hrNotify = pDirectSoundBuffer_->QueryInterface(IID_IDirectSoundNotify, (LPVOID*)&pDirectSoundNotify_);
-	DSBPOSITIONNOTIFY pn[3];
-	for (size_t iEvent = 0; iEvent < 3; ++iEvent) {
-		hEvent_[iEvent] = CreateEventW(nullptr, FALSE, FALSE, nullptr);
-		pn[iEvent].hEventNotify = hEvent_[iEvent];
-	}
-
-	pn[0].dwOffset = 0;
-	pn[1].dwOffset = sizeCopy_;
-	pn[2].dwOffset = DSBPN_OFFSETSTOP;
-	pDirectSoundNotify_->SetNotificationPositions(3, pn);
-
-	if (hrNotify == DSERR_BUFFERLOST) {
-		this->Restore();
+		//Next check right as the cursor should reach the end of the current half
+		DWORD bytePerSec = soundSource_->formatWave_.nAvgBytesPerSec;
+		DWORD byteRemain = sizeCopy_ * (indexPlaying + 1) - point;
+		uint64_t timeRemain = (uint64_t)byteRemain * 1000U / std::max(bytePerSec, 1UL) + 1;
+		return time + std::min<uint64_t>(timeRemain, STREAM_POLL_MAX);
 	}
 }
 void SoundStreamingPlayer::_CopyStream(int indexCopy) {
@@ -1147,12 +1337,27 @@ bool SoundStreamingPlayer::Play() {
 		}
 		playStyle_.timeStart_ = 0;
 
-		for (size_t iEvent = 0; iEvent < 3; ++iEvent)
-			::ResetEvent(hEvent_[iEvent]);
-
 		if (bStreaming_) {
-			thread_->Start();
+			bPlaying_ = true;
+
+			DWORD point = 0;
+			pDirectSoundBuffer_->GetCurrentPosition(&point, nullptr);
+			if (point == 0) {
+				//Fresh start, fill the first half now and let the workers fill the second right away
+				_CopyStream(0);
+				indexPlayingLast_ = -1;
+			}
+			else indexPlayingLast_ = point < sizeCopy_ ? 0 : 1;
+
 			pDirectSoundBuffer_->Play(0, 0, DSBPLAY_LOOPING);
+
+			if (manager_) {
+				DirectSoundManager::StreamRequest request;
+				request.timeDeadline = SystemUtility::GetCpuTime2();
+				request.idStream = ++idStream_;
+				request.player = std::static_pointer_cast<SoundStreamingPlayer>(shared_from_this());
+				manager_->RequestStream(request);
+			}
 		}
 		else {
 			DWORD dwFlags = 0;
@@ -1174,21 +1379,24 @@ bool SoundStreamingPlayer::Stop() {
 		if (pDirectSoundBuffer_)
 			pDirectSoundBuffer_->Stop();
 
-		if (!thread_->IsStop())
-			thread_->Stop();
+		bPlaying_ = false;
+		++idStream_;
 	}
 	return true;
 }
 void SoundStreamingPlayer::ResetStreamForSeek() {
 	if (pDirectSoundBuffer_) {
+		Lock lock(lock_);
+
 		_CopyStream(1);
 		_CopyStream(0);
 
 		pDirectSoundBuffer_->SetCurrentPosition(0);
+		indexPlayingLast_ = 0;
 	}
 }
 bool SoundStreamingPlayer::IsPlaying() {
-	return thread_->GetStatus() == Thread::RUN;
+	return bPlaying_;
 }
 DWORD SoundStreamingPlayer::GetCurrentPosition() {
 	Lock lock(lock_);
@@ -1251,42 +1459,6 @@ bool SoundStreamingPlayer::GetSamplesFFT(DWORD durationMs, size_t resolution, bo
 	return false;
 }
 
-//StreamingThread
-SoundStreamingPlayer::StreamingThread::StreamingThread(SoundStreamingPlayer* player) { 
-	_SetOuter(player); 
-}
-void SoundStreamingPlayer::StreamingThread::_Run() {
-	SoundStreamingPlayer* player = _GetOuter();
-
-	DWORD point = 0;
-	if (player->pDirectSoundBuffer_)
-		player->pDirectSoundBuffer_->GetCurrentPosition(&point, 0);
-	if (point == 0)
-		player->_CopyStream(0);
-
-	while (this->GetStatus() == RUN) {
-		DWORD num = WaitForMultipleObjects(3, player->hEvent_, FALSE, INFINITE);
-		
-		player->pDirectSoundBuffer_->GetCurrentPosition(&point, 0);
-		if (num == WAIT_OBJECT_0) {
-			if ((point - 0) < 4096)
-				player->_CopyStream(1);
-		}
-		else if (num == WAIT_OBJECT_0 + 1) {
-			if ((point - player->sizeCopy_) < 4096)
-				player->_CopyStream(0);
-		}
-		else if (num == WAIT_OBJECT_0 + 2)
-			break;
-
-		point = UINT_MAX;
-	}
-}
-void SoundStreamingPlayer::StreamingThread::Notify(size_t index) {
-	SoundStreamingPlayer* player = _GetOuter();
-	::SetEvent(player->hEvent_[index]);
-}
-
 //*******************************************************************
 //SoundPlayerWave
 //*******************************************************************
@@ -1438,7 +1610,7 @@ bool SoundStreamingPlayerWave::_CreateBuffer(shared_ptr<SoundSourceData> source)
 				ZeroMemory(&desc, sizeof(DSBUFFERDESC));
 				desc.dwSize = sizeof(DSBUFFERDESC);
 				desc.dwFlags = DSBCAPS_CTRLVOLUME | DSBCAPS_CTRLPAN | DSBCAPS_CTRLFREQUENCY
-					| DSBCAPS_CTRLPOSITIONNOTIFY | DSBCAPS_GETCURRENTPOSITION2
+					| DSBCAPS_GETCURRENTPOSITION2
 					| DSBCAPS_LOCSOFTWARE | DSBCAPS_GLOBALFOCUS;
 				desc.dwBufferBytes = sizeBuffer;
 				desc.lpwfxFormat = &pSource->formatWave_;
@@ -1451,7 +1623,7 @@ bool SoundStreamingPlayerWave::_CreateBuffer(shared_ptr<SoundSourceData> source)
 				lastReadPointer_ = pSource->posWaveStart_;
 
 				bStreaming_ = true;
-				_CreateSoundEvent(pSource->formatWave_);
+				_InitializeStream(pSource->formatWave_);
 			}
 			catch (bool) {
 				return false;
@@ -1546,7 +1718,6 @@ bool SoundStreamingPlayerWave::Seek(DWORD sample) {
 SoundStreamingPlayerOgg::SoundStreamingPlayerOgg() {}
 SoundStreamingPlayerOgg::~SoundStreamingPlayerOgg() {
 	this->Stop();
-	thread_->Join();
 }
 bool SoundStreamingPlayerOgg::_CreateBuffer(shared_ptr<SoundSourceData> source) {
 	FileManager* fileManager = FileManager::GetBase();
@@ -1567,7 +1738,7 @@ bool SoundStreamingPlayerOgg::_CreateBuffer(shared_ptr<SoundSourceData> source)
 				ZeroMemory(&desc, sizeof(DSBUFFERDESC));
 				desc.dwSize = sizeof(DSBUFFERDESC);
 				desc.dwFlags = DSBCAPS_CTRLVOLUME | DSBCAPS_CTRLPAN | DSBCAPS_CTRLFREQUENCY
-					| DSBCAPS_CTRLPOSITIONNOTIFY | DSBCAPS_GETCURRENTPOSITION2
+					| DSBCAPS_GETCURRENTPOSITION2
 					| DSBCAPS_LOCSOFTWARE | DSBCAPS_GLOBALFOCUS;
 				desc.dwBufferBytes = sizeBuffer;
 				desc.lpwfxFormat = &pSource->formatWave_;
@@ -1585,7 +1756,7 @@ bool SoundStreamingPlayerOgg::_CreateBuffer(shared_ptr<SoundSourceData> source)
 					_CopyStream(0);
 				}
 				else {
-					_CreateSoundEvent(pSource->formatWave_);
+					_InitializeStream(pSource->formatWave_);
 				}
 			}
 			catch (bool) {
@@ -1610,7 +1781,54 @@ DWORD SoundStreamingPlayerOgg::_CopyBuffer(LPVOID pMem, DWORD dwSize) {
 	DWORD resStreamPos = lastReadPointer_ * bytePerSample;
 
 	memset((char*)pMem, 0, dwSize);
-	if (OggVorbis_File* pFileOgg = source->fileOgg_) {
+	if (source->IsDecoded()) {
+		double loopStart = playStyle_.timeLoopStart_;
+		double loopEnd = playStyle_.timeLoopEnd_;
+		DWORD byteLoopStart = Math::FloorBase<DWORD>(loopStart * bytePerSec, bytePerSample);
+		DWORD byteLoopEnd = Math::FloorBase<DWORD>(loopEnd * bytePerSec, bytePerSample);
+
+		const char* pPcm = source->bufDecoded_.GetPointer();
+		DWORD sizePcm = source->bufDecoded_.GetSize();
+
+		DWORD totalWritten = 0;
+		auto _CopyPcm = [&](DWORD writeTargetSize) -> bool {
+			if (writeTargetSize == 0) return true;
+			DWORD byteCurrent = lastReadPointer_ * bytePerSample;
+			DWORD _write = byteCurrent < sizePcm ? std::min(writeTargetSize, sizePcm - byteCurrent) : 0;
+			memcpy((char*)pMem + totalWritten, pPcm + byteCurrent, _write);
+			totalWritten += _write;
+			lastReadPointer_ += _write / bytePerSample;
+			return _write < writeTargetSize;	//EOF
+		};
+
+		while (totalWritten < dwSize) {
+			DWORD byteCurrent = lastReadPointer_ * bytePerSample;
+
+			DWORD remain = dwSize - totalWritten;
+			if (playStyle_.bLoop_ && (byteCurrent + remain > byteLoopEnd && byteLoopEnd > 0)) {
+				//This read will contain the looping point
+				DWORD size1 = std::min(byteLoopEnd - byteCurrent, remain);
+				_CopyPcm(size1);
+			}
+			else {
+				bool bFileEnd = _CopyPcm(remain);
+				if (!bFileEnd)
+					continue;
+			}
+
+			//Reset to loop start
+			{
+				if (playStyle_.bLoop_) {
+					Seek(byteLoopStart / bytePerSample);
+				}
+				else {
+					_SetStreamOver();
+					break;
+				}
+			}
+		}
+	}
+	else if (OggVorbis_File* pFileOgg = source->fileOgg_) {
 		double loopStart = playStyle_.timeLoopStart_;
 		double loopEnd = playStyle_.timeLoopEnd_;
 		DWORD byteLoopStart = Math::FloorBase<DWORD>(loopStart * bytePerSec, bytePerSample);
@@ -1674,7 +1892,8 @@ bool SoundStreamingPlayerOgg::Seek(DWORD sample) {
 	SoundSourceDataOgg* source = (SoundSourceDataOgg*)soundSource_.get();
 	{
 		Lock lock(lock_);
-		ov_pcm_seek(source->fileOgg_, sample);
+		if (!source->IsDecoded())
+			ov_pcm_seek(source->fileOgg_, sample);
 		lastReadPointer_ = sample;
 	}
 	return true;
@@ -29,12 +29,22 @@ namespace directx {
 	class DirectSoundManager {
 	public:
 		class SoundManageThread;
+		class StreamingWorker;
 		friend SoundManageThread;
+		friend StreamingWorker;
 		friend SoundInfoPanel;
 	public:
 		enum {
 			SD_VOLUME_MIN = DSBVOLUME_MIN,
 			SD_VOLUME_MAX = DSBVOLUME_MAX,
+
+			STREAMING_WORKER_COUNT = 2,
+		};
+
+		struct StreamRequest {
+			uint64_t timeDeadline;		//In millis, see SystemUtility::GetCpuTime2
+			uint64_t idStream;
+			weak_ptr<SoundStreamingPlayer> player;
 		};
 	private:
 		static DirectSoundManager* thisBase_;
@@ -51,8 +61,16 @@ namespace directx {
 		std::map<std::wstring, shared_ptr<SoundSourceData>> mapSoundSource_;
 		std::map<int, SoundDivision*> mapDivision_;
 
+		//Refill requests of all streaming players, heap ordered by the earliest deadline
+		gstd::CriticalSection lockStream_;
+		gstd::ThreadSignal signalStream_;
+		std::vector<StreamRequest> listStreamRequest_;
+		std::vector<unique_ptr<StreamingWorker>> listStreamingWorker_;
+
 		shared_ptr<SoundInfoPanel> panelInfo_;
 
+		size_t sizeOggDecodeMax_;		//Max PCM size (in bytes) of Ogg files to be fully decoded on load
+
 		shared_ptr<SoundSourceData> _GetSoundSource(const std::wstring& path);
 		shared_ptr<SoundSourceData> _CreateSoundSource(std::wstring path);
 	public:
@@ -82,13 +100,23 @@ namespace directx {
 		}
 
 		void SetFadeDeleteAll();
+
+		void RequestStream(const StreamRequest& request);
+
+		void SetOggDecodeThreshold(size_t size) { sizeOggDecodeMax_ = size; }
+		size_t GetOggDecodeThreshold() { return sizeOggDecodeMax_; }
 	};
 
 	class DirectSoundManager::SoundManageThread : public gstd::Thread, public gstd::InnerClass<DirectSoundManager> {
 		friend DirectSoundManager;
+	protected:
+		enum {
+			INTERVAL_FADE = 10,
+			INTERVAL_ARRANGE = 100,
+		};
 	protected:
 		uint64_t timeCurrent_;
-		uint64_t timePrevious_;
+		uint64_t timeLastArrange_;
 	protected:
 		SoundManageThread(DirectSoundManager* manager);
 
@@ -96,6 +124,17 @@ namespace directx {
 		void _Arrange();
 		void _Fade();
 	};
+	class DirectSoundManager::StreamingWorker : public gstd::Thread, public gstd::InnerClass<DirectSoundManager> {
+		friend DirectSoundManager;
+	protected:
+		enum {
+			INTERVAL_IDLE = 100,
+		};
+	protected:
+		StreamingWorker(DirectSoundManager* manager);
+
+		void _Run();
+	};
 
 	//*******************************************************************
 	//SoundInfoPanel
@@ -176,26 +215,51 @@ namespace directx {
 		virtual bool Load(shared_ptr<gstd::FileReader> reader);
 	};
 	class SoundSourceDataOgg : public SoundSourceData {
+	public:
+		class DecodeThread;
+		friend DecodeThread;
 	public:
 		static ov_callbacks oggCallBacks_;
+		static ov_callbacks oggCallBacksMemory_;
 		OggVorbis_File* fileOgg_;
+
+		//Entire PCM stream, shared by all players of this source once bDecoded_ is set
+		gstd::ByteBuffer bufDecoded_;
+		std::atomic_bool bDecoded_;
+	protected:
+		unique_ptr<DecodeThread> threadDecode_;
 	public:
 		static size_t _ReadOgg(void* ptr, size_t size, size_t nmemb, void* source);
 		static int _SeekOgg(void* source, ogg_int64_t offset, int whence);
 		static int _CloseOgg(void* source);
 		static long _TellOgg(void* source);
+
+		static size_t _ReadOggMemory(void* ptr, size_t size, size_t nmemb, void* source);
+		static int _SeekOggMemory(void* source, ogg_int64_t offset, int whence);
+		static long _TellOggMemory(void* source);
 	public:
 		SoundSourceDataOgg();
 		~SoundSourceDataOgg();
 
 		virtual void Release();
 		virtual bool Load(shared_ptr<gstd::FileReader> reader);
+
+		bool IsDecoded() { return bDecoded_; }
+	};
+	class SoundSourceDataOgg::DecodeThread : public gstd::Thread, public gstd::InnerClass<SoundSourceDataOgg> {
+		friend SoundSourceDataOgg;
+	protected:
+		gstd::ByteBuffer bufFile_;		//Compressed file, decoded independently of fileOgg_
+	protected:
+		DecodeThread(SoundSourceDataOgg* source);
+
+		void _Run();
 	};
 
 	//*******************************************************************
 	//SoundPlayer
 	//*******************************************************************
-	class SoundPlayer {
+	class SoundPlayer : public std::enable_shared_from_this<SoundPlayer> {
 		friend DirectSoundManager;
 		friend DirectSoundManager::SoundManageThread;
 	public:
@@ -243,10 +307,16 @@ namespace directx {
 		bool bAutoDelete_;			//Allows deletion when the sound ends
 		double rateVolume_;			//0~100
 		double rateVolumeFadePerSec_;
+
+		//Fade envelope, the volume is evaluated from the elapsed time instead of accumulated per tick
+		uint64_t timeFadeBase_;
+		double rateVolumeFadeBase_;
+		double rateVolumeFadeLast_;
 		
 		bool flgUpdateStreamOffset_;
 
 		virtual bool _CreateBuffer(shared_ptr<SoundSourceData> source) = 0;
+		void _UpdateFade(uint64_t time);
 		static LONG _GetVolumeAsDirectSoundDecibel(float rate);
 
 		void _LoadSamples(byte* pWaveData, size_t pSize, double* pRes);
@@ -300,12 +370,15 @@ namespace directx {
 	//SoundStreamPlayer
 	//*******************************************************************
 	class SoundStreamingPlayer : public SoundPlayer {
-		class StreamingThread;
-		friend StreamingThread;
+		friend DirectSoundManager::StreamingWorker;
+	protected:
+		enum {
+			STREAM_POLL_MAX = 250,
+		};
 	protected:
-		HANDLE hEvent_[3];
-		IDirectSoundNotify* pDirectSoundNotify_;
-		unique_ptr<StreamingThread> thread_;
+		std::atomic_bool bPlaying_;
+		uint64_t idStream_;				//Invalidates pending refill requests on Play/Stop
+		int indexPlayingLast_;			//Buffer half the play cursor was in at the last refill check
 
 		bool bStreaming_;
 		bool bStreamOver_;
@@ -318,7 +391,8 @@ namespace directx {
 
 		DWORD lastReadPointer_;
 	protected:
-		void _CreateSoundEvent(WAVEFORMATEX& formatWave);
+		void _InitializeStream(WAVEFORMATEX& formatWave);
+		uint64_t _ServiceStream(uint64_t idStream, uint64_t time);
 
 		virtual void _CopyStream(int indexCopy);
 		virtual DWORD _CopyBuffer(LPVOID pMem, DWORD dwSize) = 0;
@@ -339,14 +413,6 @@ namespace directx {
 
 		virtual bool GetSamplesFFT(DWORD durationMs, size_t resolution, bool bAutoLog, std::vector<double>& res);
 	};
-	class SoundStreamingPlayer::StreamingThread : public gstd::Thread, public gstd::InnerClass<SoundStreamingPlayer> {
-	public:
-		StreamingThread(SoundStreamingPlayer* player);
-
-		virtual void _Run();
-
-		void Notify(size_t index);
-	};
 
 	//*******************************************************************
 	//SoundPlayerWave
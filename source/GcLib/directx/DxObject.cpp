@@ -18,11 +18,13 @@ DxScriptObjectBase::DxScriptObjectBase() {
 
 	idObject_ = DxScript::ID_INVALID;
 	idScript_ = ScriptClientBase::ID_SCRIPT_FREE;
+	indexScriptOwned_ = 0;
 	typeObject_ = TypeObject::Base;
 
 	bDelete_ = false;
 	bActive_ = false;
 	bVisible_ = true;
+	bCleanUpRequired_ = false;
 	priRender_ = 50;
 	
 	frameExist_ = 0;
@@ -33,7 +35,10 @@ DxScriptObjectBase::~DxScriptObjectBase() {
 }
 
 void DxScriptObjectBase::Clone(DxScriptObjectBase* src) {
-	idScript_ = src->idScript_;
+	if (manager_)
+		manager_->SetObjectScriptID(this, src->idScript_);
+	else
+		idScript_ = src->idScript_;
 
 	bActive_ = src->bActive_;
 	bVisible_ = src->bVisible_;
@@ -439,6 +444,13 @@ DxScriptSpriteAnimation::DxScriptSpriteAnimation() {
 	bReverse_ = false;
 	bActive_ = false;
 }
+DxScriptSpriteAnimation* DxScriptSpriteAnimation::CastFromObject(DxScriptObjectBase* obj) {
+	if (DxScriptSpriteObject2D* obj2D = DxScriptObjectBase::CastTo<DxScriptSpriteObject2D>(obj))
+		return obj2D;
+	else if (DxScriptSpriteObject3D* obj3D = DxScriptObjectBase::CastTo<DxScriptSpriteObject3D>(obj))
+		return obj3D;
+	return nullptr;
+}
 void DxScriptSpriteAnimation::AddFrame(int id, int length, DxRect<int>& rect) {
 	if (id > ANIM_INVALID) {
 		if (listAnim_.count(id) == 0)
@@ -504,9 +516,9 @@ void DxScriptSpriteAnimation::Animate() {
 		int frameLength = frame.length;
 		DxRect<int>& frameRect = frame.rect;
 
-		if (Sprite2D* spr = dynamic_cast<Sprite2D*>(sprite))
+		if (Sprite2D* spr = RenderObject::CastTo<Sprite2D>(sprite))
 			spr->SetSourceRect(frameRect);
-		else if (Sprite3D* spr = dynamic_cast<Sprite3D*>(sprite))
+		else if (Sprite3D* spr = RenderObject::CastTo<Sprite3D>(sprite))
 			spr->SetSourceRect(frameRect);
 
 		++frame_;
@@ -758,6 +770,7 @@ void DxScriptSpriteObject2D::Render() {
 //****************************************************************************
 DxScriptSpriteListObject2D::DxScriptSpriteListObject2D() {
 	typeObject_ = TypeObject::SpriteList2D;
+	bCleanUpRequired_ = true;
 	objRender_ = std::make_shared<SpriteList2D>();
 	objRender_->SetDxObjectReference(this);
 }
@@ -827,7 +840,7 @@ void DxScriptPrimitiveObject3D::Render() {
 	}
 }
 void DxScriptPrimitiveObject3D::SetRenderState() {
-	if (DxScriptMeshObject* objMesh = dynamic_cast<DxScriptMeshObject*>(objRelative_.get())) {
+	if (DxScriptMeshObject* objMesh = DxScriptObjectBase::CastTo<DxScriptMeshObject>(objRelative_.get())) {
 		objRelative_->SetRenderState();
 
 		int frameAnime = objMesh->GetAnimeFrame();
@@ -936,7 +949,7 @@ DxScriptTrajectoryObject3D::DxScriptTrajectoryObject3D() {
 
 void DxScriptTrajectoryObject3D::Work() {
 	if (TrajectoryObject3D* obj = GetRenderObject()) {
-		if (DxScriptMeshObject* objMesh = dynamic_cast<DxScriptMeshObject*>(objRelative_.get())) {
+		if (DxScriptMeshObject* objMesh = DxScriptObjectBase::CastTo<DxScriptMeshObject>(objRelative_.get())) {
 			objRelative_->SetRenderState();
 			int frameAnime = objMesh->GetAnimeFrame();
 			const std::wstring& nameAnime = objMesh->GetAnimeName();
@@ -985,6 +998,7 @@ void DxScriptTrajectoryObject3D::SetColor(int r, int g, int b) {
 //****************************************************************************
 DxScriptParticleListObject2D::DxScriptParticleListObject2D() {
 	typeObject_ = TypeObject::ParticleList2D;
+	bCleanUpRequired_ = true;
 	objRender_ = std::make_shared<ParticleRenderer2D>();
 	objRender_->SetDxObjectReference(this);
 }
@@ -1029,6 +1043,7 @@ void DxScriptParticleListObject2D::CleanUp() {
 //****************************************************************************
 DxScriptParticleListObject3D::DxScriptParticleListObject3D() {
 	typeObject_ = TypeObject::ParticleList3D;
+	bCleanUpRequired_ = true;
 	objRender_ = std::make_shared<ParticleRenderer3D>();
 	objRender_->SetDxObjectReference(this);
 }
@@ -1250,6 +1265,13 @@ void DxScriptTextObject::_UpdateRenderer() {
 		objRender_ = text_.CreateRenderObject(textInfo_);
 	change_ = 0;
 }
+void DxScriptTextObject::_SetStyleChanged() {
+	//Colors don't affect the layout unless tags captured them, only the glyphs need to be rebuilt
+	if (textInfo_ == nullptr || textInfo_->IsStyleDependent())
+		change_ = CHANGE_ALL;
+	else
+		change_ |= CHANGE_RENDERER;
+}
 void DxScriptTextObject::SetCharset(BYTE set) {
 	/*
 	switch (set) {
@@ -1319,7 +1341,7 @@ LONG DxScriptTextObject::GetTotalHeight() {
 
 void DxScriptTextObject::SetShader(shared_ptr<Shader> shader) {
 	text_.SetShader(shader);
-	change_ = CHANGE_ALL;
+	change_ |= CHANGE_RENDERER;
 }
 
 void DxScriptTextObject::SetAngleX(float x) {
@@ -1926,6 +1948,7 @@ DxScriptObjectManager::DxScriptObjectManager() {
 
 	totalObjectCreateCount_ = 0U;
 
+	listActiveObject_.reserve(DEFAULT_CONTAINER_CAPACITY);
 	listDeleteObject_.reserve(512U);
 }
 DxScriptObjectManager::~DxScriptObjectManager() {
@@ -1953,40 +1976,42 @@ void DxScriptObjectManager::SetRenderBucketCapacity(size_t capacity) {
 }
 
 int DxScriptObjectManager::AddObject(ref_unsync_ptr<DxScriptObjectBase> obj, bool bActivate) {
-	int res = DxScript::ID_INVALID;
-
-	auto ExpandContainerCapacity = [&]() -> bool {
+	int res = _ReserveObjectID();
+	if (res != DxScript::ID_INVALID)
+		_RegisterObject(obj, res, bActivate);
+	return res;
+}
+bool DxScriptObjectManager::_ReserveObjectCapacity(size_t count) {
+	while (listUnusedIndex_.size() < count) {
 		size_t oldSize = obj_.size();
-		bool res = SetMaxObject(oldSize * 2U);
-		if (res) Logger::WriteTop(StringUtility::Format("DxScriptObjectManager: Object pool expansion. [%d->%d]",
+		if (!SetMaxObject(oldSize * 2U)) return false;
+		Logger::WriteTop(StringUtility::Format("DxScriptObjectManager: Object pool expansion. [%d->%d]",
 			oldSize, obj_.size()));
-		return res;
-	};
-
-	{
-		do {
-			if (listUnusedIndex_.size() == 0U) {
-				if (!ExpandContainerCapacity()) break;
-			}
-			res = listUnusedIndex_.front();
-			listUnusedIndex_.pop_front();
-		} while (obj_[res]);
-
-		if (res != DxScript::ID_INVALID) {
-			obj_[res] = obj;
-
-			if (bActivate) {
-				obj->bActive_ = true;
-				listActiveObject_.push_back(obj);
-			}
-			obj->idObject_ = res;
-			obj->manager_ = this;
-
-			++totalObjectCreateCount_;
+	}
+	return true;
+}
+int DxScriptObjectManager::_ReserveObjectID() {
+	while (true) {
+		if (listUnusedIndex_.size() == 0U) {
+			if (!_ReserveObjectCapacity(1)) return DxScript::ID_INVALID;
 		}
+		int res = listUnusedIndex_.front();
+		listUnusedIndex_.pop_front();
+		if (obj_[res] == nullptr) return res;
 	}
+}
+void DxScriptObjectManager::_RegisterObject(ref_unsync_ptr<DxScriptObjectBase> obj, int id, bool bActivate) {
+	obj_[id] = obj;
 
-	return res;
+	if (bActivate) {
+		obj->bActive_ = true;
+		_PushActiveObject(obj);
+	}
+	obj->idObject_ = id;
+	obj->manager_ = this;
+	_AddScriptOwnership(obj.get());
+
+	++totalObjectCreateCount_;
 }
 
 void DxScriptObjectManager::ActivateObject(int id, bool bActivate) {
@@ -1997,12 +2022,18 @@ void DxScriptObjectManager::ActivateObject(ref_unsync_ptr<DxScriptObjectBase> ob
 
 	if (bActivate && !obj->IsActive()) {
 		obj->bActive_ = true;
-		listActiveObject_.push_back(obj);
+		_PushActiveObject(obj);
 	}
 	else if (!bActivate) {
 		obj->bActive_ = false;
 	}
 }
+void DxScriptObjectManager::_PushActiveObject(ref_unsync_ptr<DxScriptObjectBase>& obj) {
+	listActiveObject_.push_back(obj);
+	//Most objects have nothing to clean up, only those that do are visited in CleanupObject
+	if (obj->bCleanUpRequired_)
+		listCleanUpObject_.push_back(obj);
+}
 
 std::vector<int> DxScriptObjectManager::GetValidObjectIdentifier() {
 	std::vector<int> res;
@@ -2027,6 +2058,7 @@ void DxScriptObjectManager::_DeleteObject(int id) {
 	if (pObj->manager_)
 		pObj->manager_->listUnusedIndex_.push_back(id);
 
+	_RemoveScriptOwnership(pObj.get());
 	obj_[id] = nullptr;
 	pObj->idObject_ = DxScript::ID_INVALID;
 }
@@ -2049,44 +2081,87 @@ void DxScriptObjectManager::DeleteObject(DxScriptObjectBase* obj) {
 void DxScriptObjectManager::ClearObject() {
 	std::fill(obj_.begin(), obj_.end(), nullptr);
 	listActiveObject_.clear();
+	listCleanUpObject_.clear();
+	mapScriptOwnedObject_.clear();
 
 	listUnusedIndex_.clear();
 	for (size_t iObj = 0; iObj < obj_.size(); ++iObj) {
 		listUnusedIndex_.push_back(iObj);
 	}
 }
+
+void DxScriptObjectManager::_AddScriptOwnership(DxScriptObjectBase* obj) {
+	if (obj->idScript_ == ScriptClientBase::ID_SCRIPT_FREE) return;
+
+	std::vector<int>& listOwned = mapScriptOwnedObject_[obj->idScript_];
+	obj->indexScriptOwned_ = listOwned.size();
+	listOwned.push_back(obj->idObject_);
+}
+void DxScriptObjectManager::_RemoveScriptOwnership(DxScriptObjectBase* obj) {
+	if (obj->idScript_ == ScriptClientBase::ID_SCRIPT_FREE) return;
+
+	auto itrFind = mapScriptOwnedObject_.find(obj->idScript_);
+	if (itrFind == mapScriptOwnedObject_.end()) return;
+
+	//Swap-remove, then fix up the index of the object that got moved
+	std::vector<int>& listOwned = itrFind->second;
+	size_t index = obj->indexScriptOwned_;
+	if (index < listOwned.size() && listOwned[index] == obj->idObject_) {
+		int idBack = listOwned.back();
+		listOwned[index] = idBack;
+		listOwned.pop_back();
+		if (index < listOwned.size())
+			obj_[idBack]->indexScriptOwned_ = index;
+	}
+	if (listOwned.empty())
+		mapScriptOwnedObject_.erase(itrFind);
+}
+//Keeps the by-script operations in ascending ID order, as with the old full scan
+std::vector<int>& DxScriptObjectManager::_SortScriptOwnership(std::vector<int>& listOwned) {
+	std::sort(listOwned.begin(), listOwned.end());
+	for (size_t i = 0; i < listOwned.size(); ++i)
+		obj_[listOwned[i]]->indexScriptOwned_ = i;
+	return listOwned;
+}
+
 void DxScriptObjectManager::DeleteObjectByScriptID(int64_t idScript) {
 	if (idScript == ScriptClientBase::ID_SCRIPT_FREE) return;
 
-	for (size_t iObj = 0; iObj < obj_.size(); ++iObj) {
-		auto& pObj = obj_[iObj];
-		if (pObj == nullptr) continue;
-		if (pObj->GetScriptID() != idScript) continue;
-		DeleteObject(pObj);
-	}
+	auto itrFind = mapScriptOwnedObject_.find(idScript);
+	if (itrFind == mapScriptOwnedObject_.end()) return;
+
+	//DeleteObject only marks the objects, the list is left untouched until cleanup
+	for (int id : _SortScriptOwnership(itrFind->second))
+		DeleteObject(obj_[id].get());
 }
 void DxScriptObjectManager::OrphanObjectByScriptID(int64_t idScript) {
 	if (idScript == ScriptClientBase::ID_SCRIPT_FREE) return;
 
-	for (size_t iObj = 0; iObj < obj_.size(); ++iObj) {
-		auto& pObj = obj_[iObj];
-		if (pObj == nullptr) continue;
-		if (pObj->GetScriptID() != idScript) continue;
-		pObj->idScript_ = ScriptClientBase::ID_SCRIPT_FREE;
-	}
+	auto itrFind = mapScriptOwnedObject_.find(idScript);
+	if (itrFind == mapScriptOwnedObject_.end()) return;
+
+	for (int id : itrFind->second)
+		obj_[id]->idScript_ = ScriptClientBase::ID_SCRIPT_FREE;
+	mapScriptOwnedObject_.erase(itrFind);
 }
 std::vector<int> DxScriptObjectManager::GetObjectByScriptID(int64_t idScript) {
-	std::vector<int> res;
-
 	if (idScript != ScriptClientBase::ID_SCRIPT_FREE) {
-		for (size_t iObj = 0; iObj < obj_.size(); ++iObj) {
-			auto& pObj = obj_[iObj];
-			if (pObj == nullptr) continue;
-			if (pObj->GetScriptID() != idScript) continue;
-			res.push_back(pObj->idObject_);
-		}
+		auto itrFind = mapScriptOwnedObject_.find(idScript);
+		if (itrFind != mapScriptOwnedObject_.end())
+			return _SortScriptOwnership(itrFind->second);
 	}
-	return res;
+	return std::vector<int>();
+}
+void DxScriptObjectManager::SetObjectScriptID(DxScriptObjectBase* obj, int64_t idScript) {
+	if (obj == nullptr || obj->idScript_ == idScript) return;
+
+	//Only objects registered in this manager are indexed
+	bool bRegistered = obj->idObject_ >= 0 && obj->idObject_ < obj_.size()
+		&& obj_[obj->idObject_].get() == obj;
+
+	if (bRegistered) _RemoveScriptOwnership(obj);
+	obj->idScript_ = idScript;
+	if (bRegistered) _AddScriptOwnership(obj);
 }
 
 shared_ptr<Shader> DxScriptObjectManager::GetShader(int index) {
@@ -2104,15 +2179,28 @@ void DxScriptObjectManager::WorkObject() {
 	}
 	mapReservedSound_.clear();
 
-	for (auto itr = listActiveObject_.begin(); itr != listActiveObject_.end();) {
-		DxScriptObjectBase* obj = itr->get();
+	auto _IsDead = [](const ref_unsync_ptr<DxScriptObjectBase>& obj) {
+		return obj == nullptr || obj->IsDeleted();
+	};
+
+	//Objects created during Work are appended and processed in the same pass
+	bool bHasDead = false;
+	for (size_t iObj = 0; iObj < listActiveObject_.size(); ++iObj) {
+		//Raw pointer, Work may grow the list and invalidate references into it
+		DxScriptObjectBase* obj = listActiveObject_[iObj].get();
 		if (obj == nullptr || obj->IsDeleted()) {
-			itr = listActiveObject_.erase(itr);
+			bHasDead = true;
 			continue;
 		}
 		obj->Work();
 		++(obj->frameExist_);
-		++itr;
+	}
+
+	//Compact the active list in one pass instead of erasing nodes one by one.
+	//	Objects deleted after being visited are removed in the next frame.
+	if (bHasDead) {
+		listActiveObject_.erase(std::remove_if(listActiveObject_.begin(), listActiveObject_.end(), _IsDead),
+			listActiveObject_.end());
 	}
 }
 void DxScriptObjectManager::RenderObject() {
@@ -2148,8 +2236,16 @@ void DxScriptObjectManager::RenderObject() {
 	}
 }
 void DxScriptObjectManager::CleanupObject() {
-	for (auto& obj : listActiveObject_) {
+	bool bHasDead = false;
+	for (size_t iObj = 0; iObj < listCleanUpObject_.size(); ++iObj) {
+		DxScriptObjectBase* obj = listCleanUpObject_[iObj].get();
 		if (obj) obj->CleanUp();
+		bHasDead |= obj == nullptr || obj->IsDeleted();
+	}
+	if (bHasDead) {
+		listCleanUpObject_.erase(std::remove_if(listCleanUpObject_.begin(), listCleanUpObject_.end(),
+			[](const ref_unsync_ptr<DxScriptObjectBase>& obj) { return obj == nullptr || obj->IsDeleted(); }),
+			listCleanUpObject_.end());
 	}
 
 	for (int id : listDeleteObject_) {
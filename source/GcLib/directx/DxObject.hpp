@@ -27,10 +27,12 @@ namespace directx {
 		int idObject_;
 		TypeObject typeObject_;
 		int64_t idScript_;
+		size_t indexScriptOwned_;	//Position in the owner script's list in DxScriptObjectManager
 
 		bool bDelete_;
 		bool bActive_;
 		bool bVisible_;
+		bool bCleanUpRequired_;		//Set by classes that override CleanUp
 		int priRender_;
 
 		uint32_t frameExist_;
@@ -71,6 +73,20 @@ namespace directx {
 
 		std::unordered_map<std::wstring, gstd::value>& GetValueMap() { return mapObjectValue_; }
 		std::unordered_map<int64_t, gstd::value>& GetValueMapI() { return mapObjectValueI_; }
+
+		//Checked downcast by object type without RTTI, returns nullptr if obj isn't a T.
+		//Classes that don't derive from DxScriptObjectBase provide a static CastFromObject.
+		template<class T> static T* CastTo(DxScriptObjectBase* obj) {
+			if constexpr (std::is_same_v<T, DxScriptObjectBase>)
+				return obj;
+			else {
+				if (obj == nullptr || !T::TYPE_MASK.IsSet(obj->typeObject_)) return nullptr;
+				if constexpr (std::is_base_of_v<DxScriptObjectBase, T>)
+					return static_cast<T*>(obj);
+				else
+					return T::CastFromObject(obj);
+			}
+		}
 	};
 
 	//****************************************************************************
@@ -80,6 +96,8 @@ namespace directx {
 
 	class DxSplineObject : public DxScriptObjectBase {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Spline };
 	protected:
 		const size_t NODE = 6U;
 		const size_t ARC_PRECISION = 20U;
@@ -184,6 +202,8 @@ namespace directx {
 
 	class DxSpringMassSystemObject : public DxScriptObjectBase {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::SpringMassSystem };
 	protected:
 		const double FRAME_STEP = 1.0 / 60.0;
 
@@ -226,6 +246,14 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptRenderObject : public DxScriptObjectBase {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = {
+			TypeObject::Shader, TypeObject::Shot, TypeObject::LooseLaser, TypeObject::StraightLaser,
+			TypeObject::CurveLaser, TypeObject::Item, TypeObject::Primitive2D, TypeObject::Sprite2D,
+			TypeObject::SpriteList2D, TypeObject::ParticleList2D, TypeObject::Player, TypeObject::Spell,
+			TypeObject::Enemy, TypeObject::EnemyBoss, TypeObject::Primitive3D, TypeObject::Sprite3D,
+			TypeObject::ParticleList3D, TypeObject::Trajectory3D, TypeObject::Mesh, TypeObject::Text
+		};
 	protected:
 		bool bZWrite_;
 		bool bZTest_;
@@ -300,6 +328,11 @@ namespace directx {
 	//DxScriptShaderObject
 	//****************************************************************************
 	class DxScriptShaderObject : public DxScriptRenderObject {
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = {
+			TypeObject::Shader, TypeObject::Shot, TypeObject::LooseLaser, TypeObject::StraightLaser,
+			TypeObject::CurveLaser, TypeObject::Item
+		};
 	protected:
 		shared_ptr<Shader> shader_;
 	public:
@@ -320,6 +353,10 @@ namespace directx {
 	class DxScriptSpriteAnimation {
 		friend DxScript;
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = {
+			TypeObject::Sprite2D, TypeObject::ParticleList2D, TypeObject::Player, TypeObject::Enemy,
+			TypeObject::EnemyBoss, TypeObject::Sprite3D, TypeObject::ParticleList3D
+		};
 
 		struct AnimationFrame {
 			size_t length;
@@ -369,6 +406,8 @@ namespace directx {
 		inline bool IsActive() { return bActive_; }
 
 		void Animate();
+
+		static DxScriptSpriteAnimation* CastFromObject(DxScriptObjectBase* obj);
 	};
 
 	//****************************************************************************
@@ -376,6 +415,12 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptPrimitiveObject : public DxScriptRenderObject {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = {
+			TypeObject::Primitive2D, TypeObject::Sprite2D, TypeObject::SpriteList2D, TypeObject::ParticleList2D,
+			TypeObject::Player, TypeObject::Spell, TypeObject::Enemy, TypeObject::EnemyBoss,
+			TypeObject::Primitive3D, TypeObject::Sprite3D, TypeObject::ParticleList3D, TypeObject::Trajectory3D
+		};
 	protected:
 		shared_ptr<RenderObjectPrimitive> objRender_;
 
@@ -427,12 +472,17 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptPrimitiveObject2D : public DxScriptPrimitiveObject {
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = {
+			TypeObject::Primitive2D, TypeObject::Sprite2D, TypeObject::SpriteList2D, TypeObject::ParticleList2D,
+			TypeObject::Player, TypeObject::Spell, TypeObject::Enemy, TypeObject::EnemyBoss
+		};
+
 		DxScriptPrimitiveObject2D();
 
 		virtual void Render();
 		virtual void SetRenderState();
 
-		RenderObjectTLX* GetRenderObject() { return dynamic_cast<RenderObjectTLX*>(objRender_.get()); }
+		RenderObjectTLX* GetRenderObject() { return RenderObject::CastTo<RenderObjectTLX>(objRender_.get()); }
 
 		virtual void SetColor(int r, int g, int b);
 		virtual void SetAlpha(int alpha);
@@ -453,12 +503,17 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptSpriteObject2D : public DxScriptPrimitiveObject2D, public DxScriptSpriteAnimation {
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = {
+			TypeObject::Sprite2D, TypeObject::ParticleList2D, TypeObject::Player, TypeObject::Enemy,
+			TypeObject::EnemyBoss
+		};
+
 		DxScriptSpriteObject2D();
 
 		virtual void Render();
 
 		void Copy(DxScriptSpriteObject2D* src);
-		Sprite2D* GetSpritePointer() { return dynamic_cast<Sprite2D*>(objRender_.get()); }
+		Sprite2D* GetSpritePointer() { return RenderObject::CastTo<Sprite2D>(objRender_.get()); }
 	};
 
 	//****************************************************************************
@@ -466,6 +521,8 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptSpriteListObject2D : public DxScriptPrimitiveObject2D {
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::SpriteList2D };
+
 		DxScriptSpriteListObject2D();
 
 		virtual void CleanUp();
@@ -485,12 +542,16 @@ namespace directx {
 	class DxScriptPrimitiveObject3D : public DxScriptPrimitiveObject {
 		friend DxScript;
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = {
+			TypeObject::Primitive3D, TypeObject::Sprite3D, TypeObject::ParticleList3D
+		};
+
 		DxScriptPrimitiveObject3D();
 
 		virtual void Render();
 		virtual void SetRenderState();
 
-		RenderObjectLX* GetRenderObject() { return dynamic_cast<RenderObjectLX*>(objRender_.get()); }
+		RenderObjectLX* GetRenderObject() { return RenderObject::CastTo<RenderObjectLX>(objRender_.get()); }
 
 		virtual void SetColor(int r, int g, int b);
 		virtual void SetAlpha(int alpha);
@@ -508,11 +569,13 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptSpriteObject3D : public DxScriptPrimitiveObject3D, public DxScriptSpriteAnimation {
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Sprite3D, TypeObject::ParticleList3D };
+
 		DxScriptSpriteObject3D();
 
 		virtual void Render();
 
-		Sprite3D* GetSpritePointer() { return dynamic_cast<Sprite3D*>(objRender_.get()); }
+		Sprite3D* GetSpritePointer() { return RenderObject::CastTo<Sprite3D>(objRender_.get()); }
 	};
 
 	//****************************************************************************
@@ -520,13 +583,15 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptTrajectoryObject3D : public DxScriptPrimitiveObject {
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Trajectory3D };
+
 		DxScriptTrajectoryObject3D();
 
 		virtual void Work();
 		virtual void Render();
 		virtual void SetRenderState();
 
-		TrajectoryObject3D* GetRenderObject() { return dynamic_cast<TrajectoryObject3D*>(objRender_.get()); }
+		TrajectoryObject3D* GetRenderObject() { return RenderObject::CastTo<TrajectoryObject3D>(objRender_.get()); }
 
 		virtual void SetColor(int r, int g, int b);
 		virtual void SetAlpha(int alpha) {};
@@ -545,6 +610,8 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptParticleListObject2D : public DxScriptSpriteObject2D {
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::ParticleList2D };
+
 		DxScriptParticleListObject2D();
 
 		virtual void Render();
@@ -563,6 +630,8 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptParticleListObject3D : public DxScriptSpriteObject3D {
 	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::ParticleList3D };
+
 		DxScriptParticleListObject3D();
 
 		virtual void Render();
@@ -585,6 +654,8 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptMeshObject : public DxScriptRenderObject {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Mesh };
 	protected:
 		shared_ptr<DxMesh> mesh_;
 		int time_;
@@ -639,6 +710,8 @@ namespace directx {
 	//****************************************************************************
 	class DxScriptTextObject : public DxScriptRenderObject {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Text };
 	private:
 		enum : byte {
 			CHANGE_INFO = 0x01,
@@ -662,6 +735,7 @@ namespace directx {
 		D3DXVECTOR2 angZ_;
 
 		void _UpdateRenderer();
+		void _SetStyleChanged();
 	public:
 		DxScriptTextObject();
 
@@ -698,10 +772,10 @@ namespace directx {
 		}
 
 		void SetFontColorTop(byte r, byte g, byte b) { 
-			text_.SetFontColorTop(D3DCOLOR_ARGB(255, r, g, b)); change_ = CHANGE_ALL;
+			text_.SetFontColorTop(D3DCOLOR_ARGB(255, r, g, b)); _SetStyleChanged();
 		}
 		void SetFontColorBottom(byte r, byte g, byte b) { 
-			text_.SetFontColorBottom(D3DCOLOR_ARGB(255, r, g, b)); change_ = CHANGE_ALL;
+			text_.SetFontColorBottom(D3DCOLOR_ARGB(255, r, g, b)); _SetStyleChanged();
 		}
 		void SetFontBorderWidth(LONG width) { 
 			text_.SetFontBorderWidth(width); change_ = CHANGE_ALL;
@@ -710,7 +784,7 @@ namespace directx {
 			text_.SetFontBorderType(type); change_ = CHANGE_ALL;
 		}
 		void SetFontBorderColor(byte r, byte g, byte b) { 
-			text_.SetFontBorderColor(D3DCOLOR_ARGB(255, r, g, b)); change_ = CHANGE_ALL;
+			text_.SetFontBorderColor(D3DCOLOR_ARGB(255, r, g, b)); _SetStyleChanged();
 		}
 
 		void SetCharset(BYTE set);
@@ -745,6 +819,8 @@ namespace directx {
 	//****************************************************************************
 	class DxSoundObject : public DxScriptObjectBase {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Sound };
 	protected:
 		std::unordered_map<SoundSourceData*, weak_ptr<SoundPlayer>> mapCachedPlayers_;
 		shared_ptr<SoundPlayer> player_;
@@ -771,6 +847,8 @@ namespace directx {
 	//****************************************************************************
 	class DxFileObject : public DxScriptObjectBase {
 		friend DxScript;
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::FileText, TypeObject::FileBinary };
 	protected:
 		shared_ptr<gstd::File> file_;
 		shared_ptr<gstd::FileReader> reader_;
@@ -799,6 +877,8 @@ namespace directx {
 	//DxTextFileObject
 	//****************************************************************************
 	class DxTextFileObject : public DxFileObject {
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::FileText };
 	protected:
 		std::vector<std::vector<char>> listLine_;
 
@@ -837,6 +917,8 @@ namespace directx {
 	//DxBinaryFileObject
 	//****************************************************************************
 	class DxBinaryFileObject : public DxFileObject {
+	public:
+		static constexpr TypeObjectMask TYPE_MASK = { TypeObject::FileBinary };
 	protected:
 		byte byteOrder_;
 		byte codePage_;
@@ -901,9 +983,13 @@ namespace directx {
 		std::list<int> listUnusedIndex_;
 
 		std::vector<ref_unsync_ptr<DxScriptObjectBase>> obj_;
-		std::list<ref_unsync_ptr<DxScriptObjectBase>> listActiveObject_;
+		std::vector<ref_unsync_ptr<DxScriptObjectBase>> listActiveObject_;
+		std::vector<ref_unsync_ptr<DxScriptObjectBase>> listCleanUpObject_;
 		std::vector<int> listDeleteObject_;
 
+		//Object IDs owned by each script, kept in sync with DxScriptObjectBase::idScript_
+		std::unordered_map<int64_t, std::vector<int>> mapScriptOwnedObject_;
+
 		std::unordered_map<std::wstring, shared_ptr<SoundPlayer>> mapReservedSound_;
 
 		std::vector<RenderList> listObjRender_;
@@ -912,6 +998,15 @@ namespace directx {
 		void _SetObjectID(DxScriptObjectBase* obj, int index) { obj->idObject_ = index; obj->manager_ = this; }
 
 		void _DeleteObject(int id);
+		void _PushActiveObject(ref_unsync_ptr<DxScriptObjectBase>& obj);
+
+		bool _ReserveObjectCapacity(size_t count);
+		int _ReserveObjectID();
+		void _RegisterObject(ref_unsync_ptr<DxScriptObjectBase> obj, int id, bool bActivate);
+
+		void _AddScriptOwnership(DxScriptObjectBase* obj);
+		void _RemoveScriptOwnership(DxScriptObjectBase* obj);
+		std::vector<int>& _SortScriptOwnership(std::vector<int>& listOwned);
 	public:
 		DxScriptObjectManager();
 		virtual ~DxScriptObjectManager();
@@ -924,6 +1019,25 @@ namespace directx {
 
 		virtual int AddObject(ref_unsync_ptr<DxScriptObjectBase> obj, bool bActivate = true);
 		//void AddObject(int id, shared_ptr<DxScriptObjectBase> obj, bool bActivate = true);
+
+		//Adds the objects with all IDs reserved at once, returns the number of objects added.
+		//	Objects past the capacity limit are left unregistered.
+		template<class T>
+		size_t AddObjectBatch(std::vector<ref_unsync_ptr<T>>& listObj, std::vector<int>* listIdRes, bool bActivate = true) {
+			//Grow the pool once for the whole batch; IDs are handed out in the same order as repeated AddObject calls
+			_ReserveObjectCapacity(listObj.size());
+			if (listIdRes) listIdRes->reserve(listIdRes->size() + listObj.size());
+			listActiveObject_.reserve(listActiveObject_.size() + listObj.size());
+
+			size_t count = 0;
+			for (; count < listObj.size(); ++count) {
+				int id = _ReserveObjectID();
+				if (id < 0) break;
+				_RegisterObject(listObj[count], id, bActivate);
+				if (listIdRes) listIdRes->push_back(id);
+			}
+			return count;
+		}
 		void ActivateObject(int id, bool bActivate);
 		void ActivateObject(ref_unsync_ptr<DxScriptObjectBase> obj, bool bActivate);
 
@@ -942,6 +1056,7 @@ namespace directx {
 		void DeleteObjectByScriptID(int64_t idScript);
 		void OrphanObjectByScriptID(int64_t idScript);
 		std::vector<int> GetObjectByScriptID(int64_t idScript);
+		void SetObjectScriptID(DxScriptObjectBase* obj, int64_t idScript);
 
 		void AddRenderObject(ref_unsync_ptr<DxScriptObjectBase> obj);
 		void WorkObject();
@@ -1458,7 +1458,7 @@ value DxScript::Func_IsLoadThreadLoading(script_machine* machine, int argc, cons
 	DxScript* script = (DxScript*)machine->data;
 
 	shared_ptr<FileManager::LoadThread> thread = FileManager::GetBase()->GetLoadThread();
-	bool res = !thread->IsThreadLoadComplete();
+	bool res = !thread->IsThreadLoadComplete() || !TextureManager::GetBase()->IsLoadComplete();
 
 	return script->CreateBooleanValue(res);
 }
@@ -2829,7 +2829,7 @@ value DxScript::Func_Obj_SetParentScriptID(script_machine* machine, int argc, co
 	int64_t idScript = argc == 2 ? argv[1].as_int() : script->GetScriptID();
 
 	DxScriptObjectBase* obj = script->GetObjectPointerAs<DxScriptObjectBase>(id);
-	if (obj) obj->idScript_ = idScript;
+	if (obj) script->GetObjectManager()->SetObjectScriptID(obj, idScript);
 
 	return value();
 }
@@ -3638,8 +3638,8 @@ value DxScript::Func_ObjRender_SetPermitCamera(gstd::script_machine* machine, in
 	bool bEnable = argv[1].as_boolean();
 
 	DxScriptObjectBase* pObj = script->GetObjectPointer(id);
-	DxScriptPrimitiveObject2D* obj2D = dynamic_cast<DxScriptPrimitiveObject2D*>(pObj);
-	DxScriptTextObject* objText = dynamic_cast<DxScriptTextObject*>(pObj);
+	DxScriptPrimitiveObject2D* obj2D = DxScriptObjectBase::CastTo<DxScriptPrimitiveObject2D>(pObj);
+	DxScriptTextObject* objText = DxScriptObjectBase::CastTo<DxScriptTextObject>(pObj);
 	if (obj2D)
 		obj2D->SetPermitCamera(bEnable);
 	else if (objText)
@@ -4833,7 +4833,7 @@ value DxScript::Func_ObjParticleList_SetPosition(script_machine* machine, int ar
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->SetInstancePosition(argv[1].as_float(), argv[2].as_float(), argv[3].as_float());
 	}
@@ -4846,7 +4846,7 @@ value DxScript::Func_ObjParticleList_SetScaleSingle(script_machine* machine, int
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->SetInstanceScaleSingle(ID, argv[1].as_float());
 	}
@@ -4858,7 +4858,7 @@ value DxScript::Func_ObjParticleList_SetScaleXYZ(script_machine* machine, int ar
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle) {
 			if (argc == 4)
 				objParticle->SetInstanceScale(argv[1].as_float(), argv[2].as_float(), argv[3].as_float());
@@ -4878,7 +4878,7 @@ value DxScript::Func_ObjParticleList_SetAngleSingle(script_machine* machine, int
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->SetInstanceAngleSingle(ID, argv[1].as_float());
 	}
@@ -4890,7 +4890,7 @@ value DxScript::Func_ObjParticleList_SetAngle(script_machine* machine, int argc,
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->SetInstanceAngle(argv[1].as_float(), argv[2].as_float(), argv[3].as_float());
 	}
@@ -4902,7 +4902,7 @@ value DxScript::Func_ObjParticleList_SetColor(script_machine* machine, int argc,
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle) {
 			if (argc == 4) {
 				objParticle->SetInstanceColorRGB(argv[1].as_int(), argv[2].as_int(), argv[3].as_int());
@@ -4921,7 +4921,7 @@ value DxScript::Func_ObjParticleList_SetAlpha(script_machine* machine, int argc,
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->SetInstanceAlpha(argv[1].as_int());
 	}
@@ -4933,7 +4933,7 @@ value DxScript::Func_ObjParticleList_SetExtraData(script_machine* machine, int a
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->SetInstanceUserData(D3DXVECTOR3(argv[1].as_float(), argv[2].as_float(), argv[3].as_float()));
 	}
@@ -4945,7 +4945,7 @@ value DxScript::Func_ObjParticleList_AddInstance(script_machine* machine, int ar
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->AddInstance();
 	}
@@ -4957,7 +4957,7 @@ value DxScript::Func_ObjParticleList_ClearInstance(script_machine* machine, int
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->ClearInstance();
 	}
@@ -4969,7 +4969,7 @@ value DxScript::Func_ObjParticleList_SetAutoClearInstance(script_machine* machin
 
 	DxScriptPrimitiveObject* obj = script->GetObjectPointerAs<DxScriptPrimitiveObject>(id);
 	if (obj) {
-		ParticleRendererBase* objParticle = dynamic_cast<ParticleRendererBase*>(obj->GetRenderObject());
+		ParticleRendererBase* objParticle = RenderObject::CastTo<ParticleRendererBase>(obj->GetRenderObject());
 		if (objParticle)
 			objParticle->SetAutoClearInstance(argv[1].as_boolean());
 	}
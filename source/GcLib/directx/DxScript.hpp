@@ -62,11 +62,17 @@ namespace directx {
 		void SetRenderBucketCapacity(int capacity) { objManager_->SetRenderBucketCapacity(capacity); }
 
 		virtual int AddObject(ref_unsync_ptr<DxScriptObjectBase> obj, bool bActivate = true);
+		template<class T>
+		size_t AddObjectBatch(std::vector<ref_unsync_ptr<T>>& listObj, std::vector<int>* listIdRes, bool bActivate = true) {
+			for (auto& obj : listObj)
+				obj->idScript_ = idScript_;
+			return objManager_->AddObjectBatch(listObj, listIdRes, bActivate);
+		}
 		virtual void ActivateObject(int id, bool bActivate) { objManager_->ActivateObject(id, bActivate); }
 
 		ref_unsync_ptr<DxScriptObjectBase> GetObject(int id) { return objManager_->GetObject(id); }
 		DxScriptObjectBase* GetObjectPointer(int id) { return objManager_->GetObjectPointer(id); }
-		template<class T> T* GetObjectPointerAs(int id) { return dynamic_cast<T*>(GetObjectPointer(id)); }
+		template<class T> T* GetObjectPointerAs(int id) { return DxScriptObjectBase::CastTo<T>(GetObjectPointer(id)); }
 
 		virtual void DeleteObject(int id) { objManager_->DeleteObject(id); }
 		void ClearObject() { objManager_->ClearObject(); }
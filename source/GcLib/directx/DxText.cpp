@@ -262,6 +262,7 @@ void DxCharCache::Clear() {
 	mapPriKey_.clear();
 	mapKeyPri_.clear();
 	mapCache_.clear();
+	mapMetrics_.clear();
 }
 shared_ptr<DxCharGlyph> DxCharCache::GetChar(DxCharCacheKey& key) {
 	shared_ptr<DxCharGlyph> res;
@@ -308,6 +309,17 @@ void DxCharCache::AddChar(DxCharCacheKey& key, shared_ptr<DxCharGlyph> value) {
 		*/
 	}
 }
+bool DxCharCache::GetMetrics(const DxCharMetricsKey& key, SIZE* res) {
+	auto itr = mapMetrics_.find(key);
+	if (itr == mapMetrics_.end()) return false;
+	*res = itr->second;
+	return true;
+}
+void DxCharCache::AddMetrics(const DxCharMetricsKey& key, const SIZE& size) {
+	if (mapMetrics_.size() >= MAX_METRICS)
+		mapMetrics_.clear();
+	mapMetrics_[key] = size;
+}
 
 
 //*******************************************************************
@@ -727,19 +739,22 @@ bool DxTextRenderer::Initialize() {
 	thisBase_ = this;
 	return true;
 }
-SIZE DxTextRenderer::_GetTextSize(HDC hDC, wchar_t* pText) {
-	//文字コード
-	int charCount = 1;
-	int code = 0;
+SIZE DxTextRenderer::_GetTextSize(HDC hDC, const LOGFONT& logFont, wchar_t* pText) {
+	DxCharMetricsKey key;
+	key.code_ = *pText;
+	key.font_ = logFont;
 
 	//文字サイズ計算
 	SIZE size;
-	::GetTextExtentPoint32(hDC, pText, charCount, &size);
+	if (cache_.GetMetrics(key, &size))
+		return size;
+	::GetTextExtentPoint32(hDC, pText, 1, &size);
+	cache_.AddMetrics(key, size);
 	return size;
 }
 
 shared_ptr<DxTextLine> DxTextRenderer::_GetTextInfoSub(const std::wstring& text, DxText* dxText, DxTextInfo* textInfo,
-	shared_ptr<DxTextLine> textLine, HDC& hDC, LONG& totalWidth, LONG& totalHeight)
+	shared_ptr<DxTextLine> textLine, HDC& hDC, const LOGFONT& logFont, LONG& totalWidth, LONG& totalHeight)
 {
 	DxFont& dxFont = dxText->GetFont();
 	float sidePitch = dxText->GetSidePitch();
@@ -775,11 +790,11 @@ shared_ptr<DxTextLine> DxTextRenderer::_GetTextInfoSub(const std::wstring& text,
 
 			bool bFirstForbid = strFirstForbid.find(strNext) != std::wstring::npos;
 			if (bFirstForbid)
-				sizeNext = _GetTextSize(hDC, pNextChar);
+				sizeNext = _GetTextSize(hDC, logFont, pNextChar);
 		}
 
 		//文字サイズ計算
-		SIZE size = _GetTextSize(hDC, pText);
+		SIZE size = _GetTextSize(hDC, logFont, pText);
 		LONG lw = size.cx + widthBorder + sidePitch;
 		LONG lh = size.cy;
 		if (heightMax > 0 && totalHeight + size.cy > heightMax) {
@@ -840,8 +855,62 @@ std::vector<std::wstring> GetScannerStringArgumentList(DxTextScanner& scan, std:
 
 	return list;
 }
+bool DxTextLayoutKey::operator<(const DxTextLayoutKey& key) const {
+	if (widthMax_ != key.widthMax_) return widthMax_ < key.widthMax_;
+	if (heightMax_ != key.heightMax_) return heightMax_ < key.heightMax_;
+	if (sidePitch_ != key.sidePitch_) return sidePitch_ < key.sidePitch_;
+	if (linePitch_ != key.linePitch_) return linePitch_ < key.linePitch_;
+	if (margin_.left != key.margin_.left) return margin_.left < key.margin_.left;
+	if (margin_.top != key.margin_.top) return margin_.top < key.margin_.top;
+	if (margin_.right != key.margin_.right) return margin_.right < key.margin_.right;
+	if (margin_.bottom != key.margin_.bottom) return margin_.bottom < key.margin_.bottom;
+	if (bSyntacticAnalysis_ != key.bSyntacticAnalysis_) return bSyntacticAnalysis_ < key.bSyntacticAnalysis_;
+	if (font_.colorTop_ != key.font_.colorTop_) return font_.colorTop_ < key.font_.colorTop_;
+	if (font_.colorBottom_ != key.font_.colorBottom_) return font_.colorBottom_ < key.font_.colorBottom_;
+	if (font_.typeBorder_ != key.font_.typeBorder_) return font_.typeBorder_ < key.font_.typeBorder_;
+	if (font_.widthBorder_ != key.font_.widthBorder_) return font_.widthBorder_ < key.font_.widthBorder_;
+	if (font_.colorBorder_ != key.font_.colorBorder_) return font_.colorBorder_ < key.font_.colorBorder_;
+	int cmpFont = memcmp(&key.font_.info_, &font_.info_, sizeof(LOGFONT));
+	if (cmpFont != 0) return cmpFont < 0;
+	return text_ < key.text_;
+}
+
 shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
+	{
+		Lock lock(lock_);
+
+		DxTextLayoutKey key;
+		key.text_ = dxText->GetText();
+		key.font_ = dxText->GetFont();
+		key.widthMax_ = dxText->GetMaxWidth();
+		key.heightMax_ = dxText->GetMaxHeight();
+		key.sidePitch_ = dxText->GetSidePitch();
+		key.linePitch_ = dxText->GetLinePitch();
+		key.margin_ = dxText->GetMargin();
+		key.bSyntacticAnalysis_ = dxText->IsSyntacticAnalysis();
+
+		shared_ptr<DxTextInfo> info;
+		auto itr = mapLayout_.find(key);
+		if (itr != mapLayout_.end()) {
+			info = itr->second;
+		}
+		else {
+			info = _CreateTextInfo(dxText);
+			if (!info->bShared_)
+				return info;
+
+			if (mapLayout_.size() >= MAX_LAYOUT)
+				mapLayout_.clear();
+			mapLayout_[key] = info;
+		}
+
+		//Callers may change the valid lines and indentation, hand out a copy sharing the lines
+		return std::make_shared<DxTextInfo>(*info);
+	}
+}
+shared_ptr<DxTextInfo> DxTextRenderer::_CreateTextInfo(DxText* dxText) {
 	SetFont(dxText->dxFont_.GetLogFont());
+	LOGFONT logFontMeasure = dxText->dxFont_.GetLogFont();
 
 	DxTextInfo* res = new DxTextInfo();
 	const std::wstring& text = dxText->GetText();
@@ -903,7 +972,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 				text = _ReplaceRenderText(text);
 				if (text.size() == 0 || text == L"") continue;
 
-				textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, totalWidth, totalHeight);
+				textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, logFontMeasure, totalWidth, totalHeight);
 				if (textLine == nullptr) bEnd = true;
 			}
 			else if (typeToken == TOKEN_TAG_START) {
@@ -913,7 +982,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 				if (element == TAG_NEW_LINE) {
 					if (textLine->height_ == 0) {
 						//Insert a dummy space if there is no text
-						textLine = _GetTextInfoSub(L" ", dxText, res, textLine, hDC, totalWidth, totalHeight);
+						textLine = _GetTextInfoSub(L" ", dxText, res, textLine, hDC, logFontMeasure, totalWidth, totalHeight);
 					}
 
 					totalWidth = std::max(totalWidth, textLine->width_);
@@ -989,7 +1058,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 					size_t codeCount = textLine->GetTextCodes().size();
 					const std::wstring& text = data.tag->GetText();
 					shared_ptr<DxTextLine> textLineRuby = textLine;
-					textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, totalWidth, totalHeight);
+					textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, logFontMeasure, totalWidth, totalHeight);
 
 					SIZE sizeTextBase;
 					::GetTextExtentPoint32(hDC, &text[0], text.size(), &sizeTextBase);
@@ -1017,6 +1086,9 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 						dxTextRuby->SetFontSize(rubyFontWidth);
 						dxTextRuby->SetFontBorderWidth(dxFont.GetBorderWidth() / 2);
 						data.tag->SetRenderText(dxTextRuby);
+						res->bStyleDependent_ = true;
+						//The ruby text carries the object's position and gets its margin set when rendered
+						res->bShared_ = false;
 
 						size_t currentCodeCount = textLineRuby->GetTextCodes().size();
 						if (codeCount == currentCodeCount) {
@@ -1198,6 +1270,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 						widthBorder = dxFont.GetBorderType() != TextBorderType::None ? dxFont.GetBorderWidth() : 0L;
 						fontTemp = nullptr;
 						::SelectObject(hDC, oldFont);
+						logFontMeasure = dxFont.GetLogFont();
 						curFontData = orgFontData;
 					}
 					else {
@@ -1205,6 +1278,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 						fontTemp = std::make_shared<Font>();
 						fontTemp->CreateFontIndirect(logFont);
 						::SelectObject(hDC, fontTemp->GetHandle());
+						logFontMeasure = logFont;
 					}
 
 					font.SetBottomColor(curFontData.colorBottom);
@@ -1216,6 +1290,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 
 					data.tag->SetFont(font);
 					textLine->tag_.push_back(data.tag);
+					res->bStyleDependent_ = true;
 				}
 				else {
 					std::wstring text = TAG_START;
@@ -1229,7 +1304,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 					text = _ReplaceRenderText(text);
 					if (text.size() == 0 || text == L"") continue;
 
-					textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, totalWidth, totalHeight);
+					textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, logFontMeasure, totalWidth, totalHeight);
 					if (textLine == nullptr) bEnd = true;
 				}
 			}
@@ -1239,7 +1314,7 @@ shared_ptr<DxTextInfo> DxTextRenderer::GetTextInfo(DxText* dxText) {
 		std::wstring text = dxText->GetText();
 		text = _ReplaceRenderText(text);
 		if (text.size() > 0) {
-			textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, totalWidth, totalHeight);
+			textLine = _GetTextInfoSub(text, dxText, res, textLine, hDC, logFontMeasure, totalWidth, totalHeight);
 			res->AddTextLine(textLine);
 		}
 	}
@@ -10,6 +10,7 @@ namespace directx {
 	class DxCharGlyph;
 	class DxCharCache;
 	class DxCharCacheKey;
+	class DxCharMetricsKey;
 	class DxTextRenderer;
 	class DxText;
 
@@ -107,11 +108,24 @@ namespace directx {
 			return (memcmp(&key.font_.info_, &font_.info_, sizeof(LOGFONT)) < 0);
 		}
 	};
+	class DxCharMetricsKey {
+		friend DxCharCache;
+		friend DxTextRenderer;
+	private:
+		UINT code_;
+		LOGFONT font_;
+	public:
+		bool operator<(const DxCharMetricsKey& key) const {
+			if (code_ != key.code_) return code_ < key.code_;
+			return (memcmp(&key.font_, &font_, sizeof(LOGFONT)) < 0);
+		}
+	};
 	class DxCharCache {
 		friend DxTextRenderer;
 	public:
 		enum : size_t {
 			MAX = 1024U,
+			MAX_METRICS = 4096U,
 		};
 	private:
 		int countPri_;
@@ -119,6 +133,9 @@ namespace directx {
 		std::map<int, DxCharCacheKey> mapPriKey_;
 		std::map<DxCharCacheKey, int> mapKeyPri_;
 
+		//Character extents for text layout, independent of colors and borders
+		std::map<DxCharMetricsKey, SIZE> mapMetrics_;
+
 		void _arrange();
 	public:
 		DxCharCache();
@@ -129,6 +146,9 @@ namespace directx {
 
 		shared_ptr<DxCharGlyph> GetChar(DxCharCacheKey& key);
 		void AddChar(DxCharCacheKey& key, shared_ptr<DxCharGlyph> value);
+
+		bool GetMetrics(const DxCharMetricsKey& key, SIZE* res);
+		void AddMetrics(const DxCharMetricsKey& key, const SIZE& size);
 	};
 
 	//*******************************************************************
@@ -296,9 +316,14 @@ namespace directx {
 		int lineValidStart_;
 		int lineValidEnd_;
 		bool bAutoIndent_;
+		bool bStyleDependent_;		//Has font or ruby tags, which capture the font colors at layout time
+		bool bShared_;				//Tags hold no per-object state, the layout may be cached and reused
 		std::vector<shared_ptr<DxTextLine>> textLine_;
 	public:
-		DxTextInfo() { totalWidth_ = 0; totalHeight_ = 0; lineValidStart_ = 1; lineValidEnd_ = 0; bAutoIndent_ = false; }
+		DxTextInfo() { 
+			totalWidth_ = 0; totalHeight_ = 0; lineValidStart_ = 1; lineValidEnd_ = 0; 
+			bAutoIndent_ = false; bStyleDependent_ = false; bShared_ = true;
+		}
 		virtual ~DxTextInfo() {};
 
 		LONG GetTotalWidth() { return totalWidth_; }
@@ -309,6 +334,7 @@ namespace directx {
 		void SetValidEndLine(int line) { lineValidEnd_ = line; }
 		bool IsAutoIndent() { return bAutoIndent_; }
 		void SetAutoIndent(bool bEnable) { bAutoIndent_ = bEnable; }
+		bool IsStyleDependent() { return bStyleDependent_; }
 
 		size_t GetLineCount() { return textLine_.size(); }
 		void AddTextLine(shared_ptr<DxTextLine> text) { textLine_.push_back(text), lineValidEnd_++; }
@@ -355,17 +381,38 @@ namespace directx {
 		void SetShader(shared_ptr<Shader> shader) { shader_ = shader; }
 	};
 
+	class DxTextLayoutKey {
+		friend DxTextRenderer;
+	private:
+		std::wstring text_;
+		DxFont font_;
+		LONG widthMax_;
+		LONG heightMax_;
+		float sidePitch_;
+		float linePitch_;
+		DxRect<LONG> margin_;
+		bool bSyntacticAnalysis_;
+	public:
+		bool operator<(const DxTextLayoutKey& key) const;
+	};
+
 	class DxTextRenderer {
 		static DxTextRenderer* thisBase_;
+	public:
+		enum : size_t {
+			MAX_LAYOUT = 256U,
+		};
 	protected:
 		DxCharCache cache_;
+		std::map<DxTextLayoutKey, shared_ptr<DxTextInfo>> mapLayout_;
 		gstd::Font winFont_;
 		D3DCOLOR colorVertex_;
 		gstd::CriticalSection lock_;
 
-		SIZE _GetTextSize(HDC hDC, wchar_t* pText);
+		SIZE _GetTextSize(HDC hDC, const LOGFONT& logFont, wchar_t* pText);
 		shared_ptr<DxTextLine> _GetTextInfoSub(const std::wstring& text, DxText* dxText, DxTextInfo* textInfo,
-			shared_ptr<DxTextLine> textLine, HDC& hDC, LONG& totalWidth, LONG& totalHeight);
+			shared_ptr<DxTextLine> textLine, HDC& hDC, const LOGFONT& logFont, LONG& totalWidth, LONG& totalHeight);
+		shared_ptr<DxTextInfo> _CreateTextInfo(DxText* dxText);
 		void _CreateRenderObject(shared_ptr<DxTextRenderObject> objRender, DxText* pDxText, 
 			const POINT& pos, DxFont dxFont, shared_ptr<DxTextLine> textLine);
 		std::wstring _ReplaceRenderText(std::wstring text);
@@ -377,7 +424,7 @@ namespace directx {
 		bool Initialize();
 		gstd::CriticalSection& GetLock() { return lock_; }
 
-		void ClearCache() { cache_.Clear(); }
+		void ClearCache() { cache_.Clear(); mapLayout_.clear(); }
 		void SetFont(LOGFONT& logFont) { winFont_.CreateFontIndirect(logFont); }
 		void SetVertexColor(D3DCOLOR color) { colorVertex_ = color; }
 		shared_ptr<DxTextInfo> GetTextInfo(DxText* dxText);
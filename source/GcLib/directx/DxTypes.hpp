@@ -139,6 +139,21 @@ namespace directx {
 		Invalid = 0xff,
 	};
 
+	//Set of TypeObject values, used as a class tag for RTTI-free object downcasts
+	class TypeObjectMask {
+		uint64_t bits_[4];
+	public:
+		constexpr TypeObjectMask() : bits_{} {}
+		constexpr TypeObjectMask(std::initializer_list<TypeObject> list) : bits_{} {
+			for (TypeObject type : list)
+				bits_[(uint8_t)type >> 6] |= 1ui64 << ((uint8_t)type & 63);
+		}
+
+		constexpr bool IsSet(TypeObject type) const {
+			return (bits_[(uint8_t)type >> 6] >> ((uint8_t)type & 63)) & 1;
+		}
+	};
+
 	//*******************************************************************
 	//DxText
 	//*******************************************************************
@@ -14,8 +14,13 @@ using namespace directx;
 //MetasequoiaMeshData
 MetasequoiaMeshData::MetasequoiaMeshData() {}
 MetasequoiaMeshData::~MetasequoiaMeshData() {
+	_ClearData();
+}
+void MetasequoiaMeshData::_ClearData() {
 	for (auto& obj : renderList_) ptr_delete(obj);
 	for (auto& obj : materialList_) ptr_delete(obj);
+	renderList_.clear();
+	materialList_.clear();
 }
 bool MetasequoiaMeshData::CreateFromFileReader(shared_ptr<gstd::FileReader> reader) {
 	bool res = false;
@@ -25,6 +30,16 @@ bool MetasequoiaMeshData::CreateFromFileReader(shared_ptr<gstd::FileReader> read
 	text.resize(size);
 	reader->Read(&text[0], size);
 
+	//Keyed by content, an edited mesh simply misses and gets a new entry
+	std::wstring pathCache;
+	if (DxMeshManager* manager = DxMeshManager::GetBase()) {
+		const std::wstring& dirCache = manager->GetMeshCacheDirectory();
+		if (dirCache.size() > 0)
+			pathCache = dirCache + StringUtility::Format(L"%016llx.bin", HashUtility::Fnv1a(text.data(), text.size()));
+	}
+	if (pathCache.size() > 0 && _LoadCache(pathCache, size))
+		return true;
+
 	gstd::Scanner scanner(text);
 	try {
 		while (scanner.HasNext()) {
@@ -44,8 +59,174 @@ bool MetasequoiaMeshData::CreateFromFileReader(shared_ptr<gstd::FileReader> read
 			scanner.GetCurrentLine(), e.what()));
 		res = false;
 	}
+
+	if (res && pathCache.size() > 0)
+		_SaveCache(pathCache, size);
 	return res;
 }
+void MetasequoiaMeshData::_LoadMaterialTexture(Material* mat) {
+	std::wstring path = PathProperty::GetFileDirectory(path_) + mat->pathTexture_;
+	mat->texture_ = std::make_shared<Texture>();
+	mat->texture_->CreateFromFile(PathProperty::GetUnique(path), false, false);
+}
+void MetasequoiaMeshData::_CreateVertexBuffer(RenderObject* render) {
+	size_t countVert = render->GetVertexCount();
+	if (countVert == 0) return;
+
+	IDirect3DDevice9* device = DirectGraphics::GetBase()->GetDevice();
+	IDirect3DVertexBuffer9*& vertexBuf = render->pVertexBuffer_;
+
+	size_t vertexBufSize = std::min<size_t>(countVert, MAX_VERTEX) * sizeof(VERTEX_NX);
+	render->vertexBufferSize_ = vertexBufSize;
+
+	void* pVoid;
+	VERTEX_NX* pVertData = render->GetVertex(0);
+
+	device->CreateVertexBuffer(vertexBufSize, 0, VERTEX_NX::fvf, D3DPOOL_MANAGED, &vertexBuf, nullptr);
+
+	vertexBuf->Lock(0, vertexBufSize, &pVoid, D3DLOCK_DISCARD);
+	memcpy(pVoid, pVertData, vertexBufSize);
+	vertexBuf->Unlock();
+}
+
+bool MetasequoiaMeshData::_LoadCache(const std::wstring& pathCache, size_t sizeSource) {
+	ByteBuffer buffer;
+	{
+		File file(pathCache);
+		if (!file.Open(File::READ)) return false;
+
+		size_t sizeFile = file.GetSize();
+		buffer.SetSize(sizeFile);
+		if (file.Read(buffer.GetPointer(), sizeFile) != sizeFile) return false;
+	}
+
+	auto _CanRead = [&](size_t size) -> bool {
+		return buffer.GetOffset() + size <= buffer.GetSize();
+	};
+	auto _ReadString = [&](std::wstring& dst) -> bool {
+		if (!_CanRead(sizeof(uint32_t))) return false;
+		uint32_t length = buffer.ReadValue<uint32_t>();
+		if (!_CanRead(length * sizeof(wchar_t))) return false;
+		dst.resize(length);
+		if (length > 0)
+			buffer.Read(&dst[0], length * sizeof(wchar_t));
+		return true;
+	};
+
+	if (!_CanRead(sizeof(uint32_t) * 2 + sizeof(uint64_t))) return false;
+	if (buffer.ReadValue<uint32_t>() != CACHE_MAGIC) return false;
+	if (buffer.ReadValue<uint32_t>() != CACHE_VERSION) return false;
+	if (buffer.ReadValue<uint64_t>() != sizeSource) return false;
+
+	bool res = true;
+	{
+		//Materials
+		uint32_t countMaterial = 0;
+		if (res &= _CanRead(sizeof(uint32_t)))
+			countMaterial = buffer.ReadValue<uint32_t>();
+		for (uint32_t iMat = 0; res && iMat < countMaterial; ++iMat) {
+			Material* mat = new Material();
+			materialList_.push_back(mat);
+
+			res = _ReadString(mat->name_) && _ReadString(mat->pathTexture_) && _CanRead(sizeof(D3DMATERIAL9));
+			if (res)
+				buffer.Read(&mat->mat_, sizeof(D3DMATERIAL9));
+		}
+
+		//Render objects, vertices are stored exactly as they were built from the text
+		uint32_t countRender = 0;
+		if (res &= _CanRead(sizeof(uint32_t)))
+			countRender = buffer.ReadValue<uint32_t>();
+		for (uint32_t iRender = 0; res && iRender < countRender; ++iRender) {
+			res = _CanRead(sizeof(int32_t) + sizeof(D3DXVECTOR3) + sizeof(uint32_t));
+			if (!res) break;
+
+			int32_t indexMaterial = buffer.ReadValue<int32_t>();
+			D3DXVECTOR3 color = buffer.ReadValue<D3DXVECTOR3>();
+			uint32_t countVert = buffer.ReadValue<uint32_t>();
+
+			res = countVert <= MAX_VERTEX && _CanRead(countVert * sizeof(VERTEX_NX));
+			if (!res) break;
+
+			RenderObject* render = new RenderObject();
+			renderList_.push_back(render);
+			if (indexMaterial >= 0 && indexMaterial < materialList_.size())
+				render->material_ = materialList_[indexMaterial];
+			render->objectColor_ = color;
+
+			render->SetVertexCount(countVert);
+			if (countVert > 0)
+				buffer.Read(render->GetVertex(0), countVert * sizeof(VERTEX_NX));
+		}
+	}
+
+	if (!res) {
+		_ClearData();
+		return false;
+	}
+
+	for (Material* mat : materialList_) {
+		if (mat->pathTexture_.size() > 0)
+			_LoadMaterialTexture(mat);
+	}
+	for (RenderObject* render : renderList_)
+		_CreateVertexBuffer(render);
+
+	return true;
+}
+void MetasequoiaMeshData::_SaveCache(const std::wstring& pathCache, size_t sizeSource) {
+	//Don't write what _LoadCache would reject
+	for (RenderObject* render : renderList_) {
+		if (render->GetVertexCount() > MAX_VERTEX) return;
+	}
+
+	ByteBuffer buffer;
+
+	auto _WriteString = [&](const std::wstring& str) {
+		buffer.WriteValue<uint32_t>(str.size());
+		if (str.size() > 0)
+			buffer.Write((LPVOID)str.data(), str.size() * sizeof(wchar_t));
+	};
+
+	buffer.WriteValue<uint32_t>(CACHE_MAGIC);
+	buffer.WriteValue<uint32_t>(CACHE_VERSION);
+	buffer.WriteValue<uint64_t>(sizeSource);
+
+	buffer.WriteValue<uint32_t>(materialList_.size());
+	for (Material* mat : materialList_) {
+		_WriteString(mat->name_);
+		_WriteString(mat->pathTexture_);
+		buffer.Write(mat->mat_);
+	}
+
+	buffer.WriteValue<uint32_t>(renderList_.size());
+	for (RenderObject* render : renderList_) {
+		auto itrMat = std::find(materialList_.begin(), materialList_.end(), render->material_);
+		int32_t indexMaterial = itrMat != materialList_.end() ? std::distance(materialList_.begin(), itrMat) : -1;
+
+		size_t countVert = render->GetVertexCount();
+		buffer.WriteValue<int32_t>(indexMaterial);
+		buffer.Write(render->objectColor_);
+		buffer.WriteValue<uint32_t>(countVert);
+		if (countVert > 0)
+			buffer.Write(render->GetVertex(0), countVert * sizeof(VERTEX_NX));
+	}
+
+	//Written under a temporary name so that a concurrent launch never reads a partial file
+	File::CreateFileDirectory(pathCache);
+	std::wstring pathTemp = pathCache + StringUtility::Format(L".%u", ::GetCurrentThreadId());
+
+	bool res = false;
+	{
+		File file(pathTemp);
+		if (file.Open(File::WRITEONLY)) {
+			res = file.Write(buffer.GetPointer(), buffer.GetSize()) == buffer.GetSize();
+			file.Close();
+		}
+	}
+	if (!res || !::MoveFileExW(pathTemp.c_str(), pathCache.c_str(), MOVEFILE_REPLACE_EXISTING))
+		::DeleteFileW(pathTemp.c_str());
+}
 void MetasequoiaMeshData::_ReadMaterial(gstd::Scanner& scanner) {
 	size_t countMaterial = scanner.Next().GetInteger();
 	materialList_.resize(countMaterial);
@@ -111,10 +292,8 @@ void MetasequoiaMeshData::_ReadMaterial(gstd::Scanner& scanner) {
 			scanner.CheckType(scanner.Next(), Token::Type::TK_OPENP);
 			tok = scanner.Next();
 
-			std::wstring wPathTexture = tok.GetString();
-			std::wstring path = PathProperty::GetFileDirectory(path_) + wPathTexture;
-			mat->texture_ = std::make_shared<Texture>();
-			mat->texture_->CreateFromFile(PathProperty::GetUnique(path), false, false);
+			mat->pathTexture_ = tok.GetString();
+			_LoadMaterialTexture(mat);
 			scanner.CheckType(scanner.Next(), Token::Type::TK_CLOSEP);
 		}
 	}
@@ -420,22 +599,7 @@ void MetasequoiaMeshData::_ReadObject(gstd::Scanner& scanner) {
 			}
 		}
 
-		if (countVert > 0) {
-			IDirect3DDevice9* device = DirectGraphics::GetBase()->GetDevice();
-			IDirect3DVertexBuffer9*& vertexBuf = render->pVertexBuffer_;
-
-			size_t vertexBufSize = std::min(countVert, 65536U) * sizeof(VERTEX_NX);
-			render->vertexBufferSize_ = vertexBufSize;
-
-			void* pVoid;
-			VERTEX_NX* pVertData = render->GetVertex(0);
-
-			device->CreateVertexBuffer(vertexBufSize, 0, VERTEX_NX::fvf, D3DPOOL_MANAGED, &vertexBuf, nullptr);
-
-			vertexBuf->Lock(0, vertexBufSize, &pVoid, D3DLOCK_DISCARD);
-			memcpy(pVoid, pVertData, vertexBufSize);
-			vertexBuf->Unlock();
-		}
+		_CreateVertexBuffer(render);
 	}
 }
 
@@ -20,6 +20,14 @@ namespace directx {
 			D3DXVECTOR3 normal_;
 			virtual ~NormalData() {}
 		};
+
+		//Binary cache of the parsed mesh, see DxMeshManager::SetMeshCacheDirectory
+		enum : uint32_t {
+			CACHE_MAGIC = 0x4f514d44,	//"DMQO"
+			CACHE_VERSION = 1,
+
+			MAX_VERTEX = 65536,		//Per render object, as much as RenderObjectPrimitive holds
+		};
 	protected:
 		std::wstring path_;
 		std::vector<RenderObject*> renderList_;
@@ -27,6 +35,13 @@ namespace directx {
 
 		void _ReadMaterial(gstd::Scanner& scanner);
 		void _ReadObject(gstd::Scanner& scanner);
+
+		void _LoadMaterialTexture(Material* mat);
+		void _CreateVertexBuffer(RenderObject* render);
+
+		bool _LoadCache(const std::wstring& pathCache, size_t sizeSource);
+		void _SaveCache(const std::wstring& pathCache, size_t sizeSource);
+		void _ClearData();
 	public:
 		MetasequoiaMeshData();
 		~MetasequoiaMeshData();
@@ -42,6 +57,7 @@ namespace directx {
 		std::wstring name_;
 		D3DMATERIAL9 mat_;
 		shared_ptr<Texture> texture_;
+		std::wstring pathTexture_;		//As written in the file, relative to the mesh
 		std::string pathTextureAlpha_;
 		std::string pathTextureBump_;
 	public:
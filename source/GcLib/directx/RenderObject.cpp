@@ -41,6 +41,8 @@ void DirectionalLightingState::Apply() {
 //RenderObject
 //****************************************************************************
 RenderObject::RenderObject() {
+	maskClass_ = CLASS_MASK;
+
 	position_ = D3DXVECTOR3(0.0f, 0.0f, 0.0f);
 	angle_ = D3DXVECTOR3(0.0f, 0.0f, 0.0f);
 	scale_ = D3DXVECTOR3(1.0f, 1.0f, 1.0f);
@@ -352,6 +354,8 @@ void RenderObject::SetCoordinate2dDeviceMatrix() {
 //RenderObjectPrimitive
 //****************************************************************************
 RenderObjectPrimitive::RenderObjectPrimitive() {
+	maskClass_ = CLASS_MASK;
+
 	typePrimitive_ = D3DPT_TRIANGLELIST;
 
 	strideVertexStreamZero_ = 0;
@@ -395,6 +399,8 @@ size_t RenderObjectPrimitive::GetPrimitiveCount(D3DPRIMITIVETYPE typePrim, size_
 //RenderObjectTLX
 //****************************************************************************
 RenderObjectTLX::RenderObjectTLX() {
+	maskClass_ = CLASS_MASK;
+
 	strideVertexStreamZero_ = sizeof(VERTEX_TLX);
 	bPermitCamera_ = true;
 }
@@ -612,6 +618,8 @@ void RenderObjectTLX::SetAlpha(int alpha) {
 //RenderObjectLX
 //****************************************************************************
 RenderObjectLX::RenderObjectLX() {
+	maskClass_ = CLASS_MASK;
+
 	strideVertexStreamZero_ = sizeof(VERTEX_LX);
 }
 RenderObjectLX::~RenderObjectLX() {
@@ -994,6 +1002,8 @@ void RenderObjectNX::SetVertexNormal(size_t index, float x, float y, float z) {
 //Sprite2D
 //****************************************************************************
 Sprite2D::Sprite2D() {
+	maskClass_ = CLASS_MASK;
+
 	SetVertexCount(4);	//Top-left, top-right, bottom-left, bottom-right (Z pattern)
 	SetPrimitiveType(D3DPT_TRIANGLESTRIP);
 
@@ -1057,6 +1067,8 @@ void Sprite2D::SetDestinationCenter() {
 //SpriteList2D
 //****************************************************************************
 SpriteList2D::SpriteList2D() {
+	maskClass_ = CLASS_MASK;
+
 	countRenderIndex_ = 0;
 	countRenderIndexPrev_ = 0;
 	countRenderVertex_ = 0;
@@ -1305,6 +1317,8 @@ void SpriteList2D::SetColor(D3DCOLOR color) {
 //Sprite3D
 //****************************************************************************
 Sprite3D::Sprite3D() {
+	maskClass_ = CLASS_MASK;
+
 	SetVertexCount(4);	//Top-left, top-right, bottom-left, bottom-right (Z pattern)
 	SetPrimitiveType(D3DPT_TRIANGLESTRIP);
 	bBillboard_ = false;
@@ -1383,6 +1397,8 @@ void Sprite3D::SetVertex(const DxRect<double>& rcSrcDst, D3DCOLOR color) {
 //TrajectoryObject3D
 //****************************************************************************
 TrajectoryObject3D::TrajectoryObject3D() {
+	maskClass_ = CLASS_MASK;
+
 	SetPrimitiveType(D3DPT_TRIANGLESTRIP);
 	diffAlpha_ = 20;
 	countComplement_ = 8;
@@ -1511,6 +1527,13 @@ ParticleRendererBase::ParticleRendererBase() {
 }
 ParticleRendererBase::~ParticleRendererBase() {
 }
+ParticleRendererBase* ParticleRendererBase::CastFromRenderObject(RenderObject* obj) {
+	if (ParticleRenderer2D* obj2D = obj->CastTo<ParticleRenderer2D>())
+		return obj2D;
+	else if (ParticleRenderer3D* obj3D = obj->CastTo<ParticleRenderer3D>())
+		return obj3D;
+	return nullptr;
+}
 
 void ParticleRendererBase::CopyParticle(ParticleRendererBase* src) {
 	countInstance_ = src->countInstance_;
@@ -1573,6 +1596,7 @@ void ParticleRendererBase::SetInstanceAngleSingle(size_t index, float ang) {
 }
 
 ParticleRenderer2D::ParticleRenderer2D() {
+	maskClass_ = CLASS_MASK;
 }
 void ParticleRenderer2D::Render() {
 	DirectGraphics* graphics = DirectGraphics::GetBase();
@@ -1701,6 +1725,7 @@ void ParticleRenderer2D::Copy(RenderObject* _src) {
 }
 
 ParticleRenderer3D::ParticleRenderer3D() {
+	maskClass_ = CLASS_MASK;
 }
 void ParticleRenderer3D::Render() {
 	DirectGraphics* graphics = DirectGraphics::GetBase();
@@ -2043,29 +2068,32 @@ shared_ptr<DxMesh> DxMeshManager::CreateFromFileInLoadThread(const std::wstring&
 }
 void DxMeshManager::CallFromLoadThread(shared_ptr<FileManager::LoadThreadEvent> event) {
 	const std::wstring& path = event->GetPath();
+
+	shared_ptr<DxMesh> mesh = std::dynamic_pointer_cast<DxMesh>(event->GetSource());
+	if (mesh == nullptr) return;
+
+	shared_ptr<DxMeshData> data;
 	{
 		Lock lock(lock_);
-		shared_ptr<DxMesh> mesh = std::dynamic_pointer_cast<DxMesh>(event->GetSource());
-		if (mesh == nullptr) return;
-
-		shared_ptr<DxMeshData> data = mesh->data_;
-		if (data->bLoad_) return;
+		data = mesh->data_;
+	}
+	if (data == nullptr || data->bLoad_) return;
 
-		std::wstring pathReduce = PathProperty::ReduceModuleDirectory(path);
+	//Parsed without holding the manager lock, the data is already registered and Render waits on bLoad_
+	std::wstring pathReduce = PathProperty::ReduceModuleDirectory(path);
 
-		bool res = false;
-		shared_ptr<FileReader> reader = FileManager::GetBase()->GetFileReader(path);
-		if (reader != nullptr && reader->Open())
-			res = data->CreateFromFileReader(reader);
+	bool res = false;
+	shared_ptr<FileReader> reader = FileManager::GetBase()->GetFileReader(path);
+	if (reader != nullptr && reader->Open())
+		res = data->CreateFromFileReader(reader);
 
-		if (res) {
-			Logger::WriteTop(StringUtility::Format(L"DxMeshManager(LT): Mesh loaded. [%s]", pathReduce.c_str()));
-		}
-		else {
-			Logger::WriteTop(StringUtility::Format(L"DxMeshManager(LT): Failed to load mesh \"%s\"", pathReduce.c_str()));
-		}
-		data->bLoad_ = true;
+	if (res) {
+		Logger::WriteTop(StringUtility::Format(L"DxMeshManager(LT): Mesh loaded. [%s]", pathReduce.c_str()));
+	}
+	else {
+		Logger::WriteTop(StringUtility::Format(L"DxMeshManager(LT): Failed to load mesh \"%s\"", pathReduce.c_str()));
 	}
+	data->bLoad_ = true;
 }
 
 //DxMeshInfoPanel
@@ -38,7 +38,22 @@ namespace directx {
 	//	Base class for ObjRender
 	//****************************************************************************
 	class RenderObject {
+	public:
+		//Class tags for CastTo, each class sets its bits in its constructor
+		enum : uint8_t {
+			CLASS_PRIMITIVE = 0x01,
+			CLASS_TLX = 0x02,
+			CLASS_LX = 0x04,
+			CLASS_SPRITE_2D = 0x08,
+			CLASS_SPRITE_LIST_2D = 0x10,
+			CLASS_SPRITE_3D = 0x20,
+			CLASS_TRAJECTORY_3D = 0x40,
+			CLASS_PARTICLE = 0x80,
+		};
+		static constexpr uint8_t CLASS_MASK = 0;
 	protected:
+		uint8_t maskClass_;
+
 		DxScriptRenderObject* dxObjParent_;
 
 		DirectionalLightingState lightParameter_;
@@ -114,6 +129,20 @@ namespace directx {
 
 		shared_ptr<Shader> GetShader() { return shader_; }
 		void SetShader(shared_ptr<Shader> shader) { shader_ = shader; }
+
+		//Checked downcast without RTTI, returns nullptr if this isn't a T.
+		//Classes outside of this hierarchy provide a static CastFromRenderObject.
+		template<class T> T* CastTo() {
+			if ((maskClass_ & T::CLASS_MASK) != T::CLASS_MASK) return nullptr;
+			if constexpr (std::is_base_of_v<RenderObject, T>)
+				return static_cast<T*>(this);
+			else
+				return T::CastFromRenderObject(this);
+		}
+		//Same as above, but also accepts nullptr like dynamic_cast did
+		template<class T> static T* CastTo(RenderObject* obj) {
+			return obj ? obj->CastTo<T>() : nullptr;
+		}
 	};
 
 	//****************************************************************************
@@ -121,6 +150,8 @@ namespace directx {
 	//	ObjRender with vertices
 	//****************************************************************************
 	class RenderObjectPrimitive : public RenderObject {
+	public:
+		static constexpr uint8_t CLASS_MASK = CLASS_PRIMITIVE;
 	protected:
 		D3DPRIMITIVETYPE typePrimitive_;
 
@@ -155,6 +186,8 @@ namespace directx {
 	//	2D render object
 	//****************************************************************************
 	class RenderObjectTLX : public RenderObjectPrimitive {
+	public:
+		static constexpr uint8_t CLASS_MASK = CLASS_PRIMITIVE | CLASS_TLX;
 	protected:
 		bool bPermitCamera_;
 		std::vector<byte> vertCopy_;
@@ -193,6 +226,8 @@ namespace directx {
 	//****************************************************************************
 	class RenderObjectLX : public RenderObjectPrimitive {
 	public:
+		static constexpr uint8_t CLASS_MASK = CLASS_PRIMITIVE | CLASS_LX;
+
 		RenderObjectLX();
 		virtual ~RenderObjectLX();
 
@@ -252,6 +287,8 @@ namespace directx {
 	//****************************************************************************
 	class Sprite2D : public RenderObjectTLX {
 	public:
+		static constexpr uint8_t CLASS_MASK = RenderObjectTLX::CLASS_MASK | CLASS_SPRITE_2D;
+
 		Sprite2D();
 		~Sprite2D();
 		
@@ -268,6 +305,9 @@ namespace directx {
 	//	Render list of 2D sprites
 	//****************************************************************************
 	class SpriteList2D : public RenderObjectTLX {
+	public:
+		static constexpr uint8_t CLASS_MASK = RenderObjectTLX::CLASS_MASK | CLASS_SPRITE_LIST_2D;
+	private:
 		size_t countRenderIndex_;
 		size_t countRenderIndexPrev_;
 		size_t countRenderVertex_;
@@ -319,6 +359,8 @@ namespace directx {
 	//	RenderObjectLX with pre-defined 4-vertex layout
 	//****************************************************************************
 	class Sprite3D : public RenderObjectLX {
+	public:
+		static constexpr uint8_t CLASS_MASK = RenderObjectLX::CLASS_MASK | CLASS_SPRITE_3D;
 	protected:
 		bool bBillboard_;
 	public:
@@ -343,6 +385,9 @@ namespace directx {
 	//	Fuck?
 	//****************************************************************************
 	class TrajectoryObject3D : public RenderObjectLX {
+	public:
+		static constexpr uint8_t CLASS_MASK = RenderObjectLX::CLASS_MASK | CLASS_TRAJECTORY_3D;
+	private:
 		struct Data {
 			int alpha;
 			D3DXVECTOR3 pos1;
@@ -384,6 +429,8 @@ namespace directx {
 	//	Base class for instanced render objects
 	//****************************************************************************
 	class ParticleRendererBase {
+	public:
+		static constexpr uint8_t CLASS_MASK = RenderObject::CLASS_PARTICLE;
 	protected:
 		size_t countInstance_;
 		size_t countInstancePrev_;
@@ -428,6 +475,8 @@ namespace directx {
 		}
 
 		void SetInstanceUserData(const D3DXVECTOR3& data) { instUserData_ = data; }
+
+		static ParticleRendererBase* CastFromRenderObject(RenderObject* obj);
 	};
 
 	//****************************************************************************
@@ -436,6 +485,8 @@ namespace directx {
 	//****************************************************************************
 	class ParticleRenderer2D : public ParticleRendererBase, public Sprite2D {
 	public:
+		static constexpr uint8_t CLASS_MASK = Sprite2D::CLASS_MASK | CLASS_PARTICLE;
+
 		ParticleRenderer2D();
 
 		virtual void Render();
@@ -449,6 +500,8 @@ namespace directx {
 	//****************************************************************************
 	class ParticleRenderer3D : public ParticleRendererBase, public Sprite3D {
 	public:
+		static constexpr uint8_t CLASS_MASK = Sprite3D::CLASS_MASK | CLASS_PARTICLE;
+
 		ParticleRenderer3D();
 
 		virtual void Render();
@@ -538,6 +591,9 @@ namespace directx {
 
 		shared_ptr<DxMeshInfoPanel> panelInfo_;
 
+		//Parsed mesh cache, disabled while the directory is empty
+		std::wstring pathMeshCache_;
+
 		void _AddMeshData(const std::wstring& name, shared_ptr<DxMeshData> data);
 		shared_ptr<DxMeshData> _GetMeshData(const std::wstring& name);
 		void _ReleaseMeshData(const std::wstring& name);
@@ -559,6 +615,9 @@ namespace directx {
 		virtual void CallFromLoadThread(shared_ptr<gstd::FileManager::LoadThreadEvent> event);
 
 		void SetInfoPanel(shared_ptr<DxMeshInfoPanel> panel) { panelInfo_ = panel; }
+
+		void SetMeshCacheDirectory(const std::wstring& dir) { pathMeshCache_ = dir; }
+		const std::wstring& GetMeshCacheDirectory() { return pathMeshCache_; }
 	};
 
 	class DxMeshInfoPanel : public gstd::WindowLogger::Panel {
@@ -252,9 +252,23 @@ size_t Texture::GetFormatBPP(D3DFORMAT format) {
 const std::wstring TextureManager::TARGET_TRANSITION = L"__RENDERTARGET_TRANSITION__";
 TextureManager* TextureManager::thisBase_ = nullptr;
 TextureManager::TextureManager() {
+	countLoadPending_ = 0;
 
+	sizeImageCacheMax_ = 256ui64 * 1024ui64 * 1024ui64;
+	countImageCacheHit_ = 0;
+	countImageCacheMiss_ = 0;
+	timeImageCacheSaved_ = 0;
 }
 TextureManager::~TextureManager() {
+	//Idle workers sleep until signaled, each one passes the wake-up on as it exits
+	for (auto& worker : listLoadWorker_)
+		worker->Stop();
+	signalLoad_.SetSignal();
+	for (auto& worker : listLoadWorker_)
+		worker->Join();
+	listLoadWorker_.clear();
+	listLoadQueue_.clear();
+
 	DirectGraphics* graphics = DirectGraphics::GetBase();
 	graphics->RemoveDirectGraphicsListener(this);
 	this->Clear();
@@ -277,6 +291,17 @@ bool TextureManager::Initialize() {
 
 	FileManager::GetBase()->AddLoadThreadListener(this);
 
+	if (pathImageCache_.size() > 0)
+		_TrimImageCache();
+
+	//Textures loaded "in the load thread" get decoded by their own pool instead of the shared FileManager thread,
+	//	D3DX can be called from any of them as the device is created with D3DCREATE_MULTITHREADED
+	size_t countWorker = std::clamp<size_t>(std::thread::hardware_concurrency(), 2U, MAX_LOAD_WORKER + 1U) - 1U;
+	for (size_t iWorker = 0; iWorker < countWorker; ++iWorker) {
+		listLoadWorker_.push_back(unique_ptr<LoadWorker>(new LoadWorker(this)));
+		listLoadWorker_.back()->Start();
+	}
+
 	return res;
 }
 void TextureManager::Clear() {
@@ -425,6 +450,160 @@ void TextureManager::RestoreDxResource() {
 	}
 }
 
+bool TextureManager::_LoadImageCache(shared_ptr<TextureData>& dst, const std::wstring& pathCache, size_t sizeSource) {
+	auto timeStart = SystemUtility::GetCpuTime();
+
+	HANDLE hFile = ::CreateFileW(pathCache.c_str(), GENERIC_READ | FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER sizeFile;
+	HANDLE hMapping = nullptr;
+	const byte* pView = nullptr;
+	if (::GetFileSizeEx(hFile, &sizeFile) && sizeFile.QuadPart >= sizeof(ImageCacheHeader)) {
+		hMapping = ::CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (hMapping)
+			pView = (const byte*)::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+	}
+
+	bool res = false;
+	if (pView) {
+		const ImageCacheHeader* header = (const ImageCacheHeader*)pView;
+		const byte* pPixel = pView + sizeof(ImageCacheHeader);
+
+		bool bValid = header->magic == ImageCacheHeader::MAGIC && header->version == ImageCacheHeader::VERSION
+			&& header->sizeSource == sizeSource
+			&& sizeFile.QuadPart == sizeof(ImageCacheHeader) + (uint64_t)header->pitch * header->height;
+
+		IDirect3DTexture9* pTexture = nullptr;
+		if (bValid) {
+			HRESULT hr = D3DXCreateTexture(DirectGraphics::GetBase()->GetDevice(), header->width, header->height,
+				dst->useMipMap_ ? D3DX_DEFAULT : 1, 0, header->format, D3DPOOL_MANAGED, &pTexture);
+			bValid = SUCCEEDED(hr);
+		}
+		if (bValid) {
+			D3DLOCKED_RECT rect;
+			bValid = SUCCEEDED(pTexture->LockRect(0, &rect, nullptr, 0));
+			if (bValid) {
+				for (uint32_t iRow = 0; iRow < header->height; ++iRow)
+					memcpy((byte*)rect.pBits + iRow * rect.Pitch, pPixel + iRow * header->pitch, header->pitch);
+				pTexture->UnlockRect(0);
+			}
+		}
+		//Same filter D3DX uses for the mip chain when loading from file
+		if (bValid && dst->useMipMap_)
+			bValid = SUCCEEDED(D3DXFilterTexture(pTexture, nullptr, 0, D3DX_FILTER_BOX));
+
+		if (bValid) {
+			dst->pTexture_ = pTexture;
+			dst->infoImage_ = header->infoImage;
+
+			int64_t timeLoad = stdch::duration_cast<stdch::microseconds>(SystemUtility::GetCpuTime() - timeStart).count();
+			++countImageCacheHit_;
+			timeImageCacheSaved_ += header->timeDecode - timeLoad;
+			res = true;
+
+			//Last access times are often not maintained, mark the entry as recently used for _TrimImageCache
+			FILETIME timeNow;
+			::GetSystemTimeAsFileTime(&timeNow);
+			::SetFileTime(hFile, nullptr, nullptr, &timeNow);
+		}
+		else ptr_release(pTexture);
+
+		::UnmapViewOfFile(pView);
+	}
+	if (hMapping)
+		::CloseHandle(hMapping);
+	::CloseHandle(hFile);
+
+	return res;
+}
+void TextureManager::_SaveImageCache(shared_ptr<TextureData>& dst, const std::wstring& pathCache, size_t sizeSource, int64_t timeDecode) {
+	D3DSURFACE_DESC desc;
+	if (FAILED(dst->pTexture_->GetLevelDesc(0, &desc))) return;
+
+	//Block-compressed and exotic formats are left to D3DX
+	size_t bpp = Texture::GetFormatBPP(desc.Format);
+	if (bpp < 2U) return;
+
+	ImageCacheHeader header;
+	ZeroMemory(&header, sizeof(ImageCacheHeader));
+	header.magic = ImageCacheHeader::MAGIC;
+	header.version = ImageCacheHeader::VERSION;
+	header.sizeSource = sizeSource;
+	header.timeDecode = timeDecode;
+	header.infoImage = dst->infoImage_;
+	header.format = desc.Format;
+	header.width = desc.Width;
+	header.height = desc.Height;
+	header.pitch = desc.Width * bpp;
+
+	std::vector<byte> bufPixel((size_t)header.pitch * header.height);
+	{
+		D3DLOCKED_RECT rect;
+		if (FAILED(dst->pTexture_->LockRect(0, &rect, nullptr, D3DLOCK_READONLY))) return;
+		for (uint32_t iRow = 0; iRow < header.height; ++iRow)
+			memcpy(&bufPixel[iRow * header.pitch], (byte*)rect.pBits + iRow * rect.Pitch, header.pitch);
+		dst->pTexture_->UnlockRect(0);
+	}
+
+	//Written under a temporary name so that a concurrent launch never maps a partial file
+	File::CreateFileDirectory(pathCache);
+	std::wstring pathTemp = pathCache + StringUtility::Format(L".%u", ::GetCurrentThreadId());
+
+	HANDLE hFile = ::CreateFileW(pathTemp.c_str(), GENERIC_WRITE, 0, nullptr,
+		CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) return;
+
+	DWORD sizeWrite = 0;
+	bool res = ::WriteFile(hFile, &header, sizeof(ImageCacheHeader), &sizeWrite, nullptr)
+		&& ::WriteFile(hFile, bufPixel.data(), bufPixel.size(), &sizeWrite, nullptr)
+		&& sizeWrite == bufPixel.size();
+	::CloseHandle(hFile);
+
+	if (!res || !::MoveFileExW(pathTemp.c_str(), pathCache.c_str(), MOVEFILE_REPLACE_EXISTING))
+		::DeleteFileW(pathTemp.c_str());
+}
+void TextureManager::_TrimImageCache() {
+	struct CacheEntry {
+		std::wstring path;
+		uint64_t size;
+		uint64_t timeUse;
+	};
+	std::vector<CacheEntry> listEntry;
+	uint64_t sizeTotal = 0;
+
+	WIN32_FIND_DATAW data;
+	HANDLE hFind = ::FindFirstFileW((pathImageCache_ + L"*.bin").c_str(), &data);
+	if (hFind == INVALID_HANDLE_VALUE) return;
+	do {
+		if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) continue;
+		CacheEntry entry;
+		entry.path = pathImageCache_ + data.cFileName;
+		entry.size = ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+		entry.timeUse = ((uint64_t)data.ftLastWriteTime.dwHighDateTime << 32) | data.ftLastWriteTime.dwLowDateTime;
+		listEntry.push_back(entry);
+		sizeTotal += entry.size;
+	} while (::FindNextFileW(hFind, &data));
+	::FindClose(hFind);
+
+	if (sizeTotal <= sizeImageCacheMax_) return;
+
+	//Oldest first, stale entries of edited images are never used again and go first
+	std::sort(listEntry.begin(), listEntry.end(), [](const CacheEntry& a, const CacheEntry& b) {
+		return a.timeUse < b.timeUse;
+	});
+	size_t countDelete = 0;
+	for (CacheEntry& entry : listEntry) {
+		if (sizeTotal <= sizeImageCacheMax_) break;
+		if (::DeleteFileW(entry.path.c_str())) {
+			sizeTotal -= entry.size;
+			++countDelete;
+		}
+	}
+
+	Logger::WriteTop(StringUtility::Format(L"TextureManager: Removed %u unused image cache entries.", (UINT)countDelete));
+}
 void TextureManager::__CreateFromFile(shared_ptr<TextureData>& dst, const std::wstring& path, bool genMipmap, bool flgNonPowerOfTwo) {
 	DirectGraphics* graphics = DirectGraphics::GetBase();
 
@@ -437,19 +616,33 @@ void TextureManager::__CreateFromFile(shared_ptr<TextureData>& dst, const std::w
 	dst->useMipMap_ = genMipmap;
 	dst->useNonPowerOfTwo_ = flgNonPowerOfTwo;
 
-	HRESULT hr = D3DXCreateTextureFromFileInMemoryEx(DirectGraphics::GetBase()->GetDevice(),
-		source.c_str(), source.size(),
-		dst->useNonPowerOfTwo_ ? D3DX_DEFAULT_NONPOW2 : D3DX_DEFAULT,
-		dst->useNonPowerOfTwo_ ? D3DX_DEFAULT_NONPOW2 : D3DX_DEFAULT,
-		dst->useMipMap_ ? D3DX_DEFAULT : 1, 0,
-		D3DFMT_UNKNOWN, D3DPOOL_MANAGED, D3DX_FILTER_BOX, D3DX_DEFAULT, 0x00000000,
-		nullptr, nullptr, &(dst->pTexture_));
-	if (FAILED(hr))
-		throw wexception("D3DXCreateTextureFromFileInMemoryEx failure.");
-
-	hr = D3DXGetImageInfoFromFileInMemory(source.c_str(), source.size(), &dst->infoImage_);
-	if (FAILED(hr))
-		throw wexception("D3DXGetImageInfoFromFileInMemory failure.");
+	//Keyed by content, an edited image simply misses and gets a new entry
+	std::wstring pathCache;
+	if (pathImageCache_.size() > 0) {
+		uint64_t hash = HashUtility::Fnv1a(source.data(), source.size());
+		hash = HashUtility::Combine(hash, flgNonPowerOfTwo);
+		pathCache = pathImageCache_ + StringUtility::Format(L"%016llx.bin", hash);
+	}
+
+	if (pathCache.size() == 0 || !_LoadImageCache(dst, pathCache, source.size())) {
+		auto timeStart = SystemUtility::GetCpuTime();
+
+		HRESULT hr = D3DXCreateTextureFromFileInMemoryEx(DirectGraphics::GetBase()->GetDevice(),
+			source.c_str(), source.size(),
+			dst->useNonPowerOfTwo_ ? D3DX_DEFAULT_NONPOW2 : D3DX_DEFAULT,
+			dst->useNonPowerOfTwo_ ? D3DX_DEFAULT_NONPOW2 : D3DX_DEFAULT,
+			dst->useMipMap_ ? D3DX_DEFAULT : 1, 0,
+			D3DFMT_UNKNOWN, D3DPOOL_MANAGED, D3DX_FILTER_BOX, D3DX_DEFAULT, 0x00000000,
+			&dst->infoImage_, nullptr, &(dst->pTexture_));
+		if (FAILED(hr))
+			throw wexception("D3DXCreateTextureFromFileInMemoryEx failure.");
+
+		if (pathCache.size() > 0) {
+			int64_t timeDecode = stdch::duration_cast<stdch::microseconds>(SystemUtility::GetCpuTime() - timeStart).count();
+			++countImageCacheMiss_;
+			_SaveImageCache(dst, pathCache, source.size(), timeDecode);
+		}
+	}
 	dst->CalculateResourceSize();
 
 	dst->manager_ = this;
@@ -478,7 +671,16 @@ bool TextureManager::_CreateFromFile(shared_ptr<TextureData>& dst, const std::ws
 		res = false;
 	}
 
-	if (res) mapTextureData_[path] = data;
+	if (res) {
+		Lock lock(lock_);
+
+		//Another thread may have finished the same file first, keep the one already registered
+		auto itr = mapTextureData_.find(path);
+		if (itr != mapTextureData_.end())
+			data = itr->second;
+		else
+			mapTextureData_[path] = data;
+	}
 	dst = data;
 
 	return res;
@@ -565,31 +767,29 @@ bool TextureManager::_CreateRenderTarget(shared_ptr<TextureData>& dst, const std
 }
 shared_ptr<Texture> TextureManager::CreateFromFile(const std::wstring& path, bool genMipmap, bool flgNonPowerOfTwo) {
 	//path = PathProperty::GetUnique(path);
-	shared_ptr<Texture> res;
+	shared_ptr<TextureData> data;
 	{
 		Lock lock(lock_);
 
 		auto itr = mapTexture_.find(path);
-		if (itr != mapTexture_.end()) {
-			res = itr->second;
-		}
-		else {
-			shared_ptr<TextureData> data;
+		if (itr != mapTexture_.end())
+			return itr->second;
 
-			auto itrFind = mapTextureData_.find(path);
-			if (itrFind != mapTextureData_.end()) {
-				data = itrFind->second;
-			}
-			else {
-				if (!_CreateFromFile(data, path, genMipmap, flgNonPowerOfTwo))
-					data = nullptr;
-			}
-			
-			if (data) {
-				res = std::make_shared<Texture>();
-				res->data_ = data;
-			}
-		}
+		auto itrFind = mapTextureData_.find(path);
+		if (itrFind != mapTextureData_.end())
+			data = itrFind->second;
+	}
+
+	//Decode outside of the lock, _CreateFromFile only locks to register the result
+	if (data == nullptr) {
+		if (!_CreateFromFile(data, path, genMipmap, flgNonPowerOfTwo))
+			data = nullptr;
+	}
+
+	shared_ptr<Texture> res;
+	if (data) {
+		res = std::make_shared<Texture>();
+		res->data_ = data;
 	}
 	return res;
 }
@@ -629,103 +829,147 @@ shared_ptr<Texture> TextureManager::CreateFromFileInLoadThread(const std::wstrin
 	//path = PathProperty::GetUnique(path);
 	shared_ptr<Texture> res;
 	{
-		//Lock lock(lock_);
+		Lock lock(lock_);
 
 		auto itr = mapTexture_.find(path);
-		if (itr != mapTexture_.end()) {
-			res = itr->second;
-		}
-		else {
-			res = std::make_shared<Texture>();
+		if (itr != mapTexture_.end())
+			return itr->second;
 
-			if (!IsDataExists(path)) {
-				std::wstring pathReduce = PathProperty::ReduceModuleDirectory(path);
+		res = std::make_shared<Texture>();
+		if (IsDataExists(path))
+			return res;
+	}
 
-				shared_ptr<TextureData> data(new TextureData());
+	std::wstring pathReduce = PathProperty::ReduceModuleDirectory(path);
 
-				data->manager_ = this;
-				data->name_ = path;
-				data->bReady_ = false;
-				data->useMipMap_ = genMipmap;
-				data->useNonPowerOfTwo_ = flgNonPowerOfTwo;
-				data->type_ = TextureData::Type::TYPE_TEXTURE;
+	shared_ptr<TextureData> data(new TextureData());
 
-				if (bLoadImageInfo) {
-					try {
-						shared_ptr<FileReader> reader = FileManager::GetBase()->GetFileReader(path);
-						if (reader == nullptr || !reader->Open())
-							throw wexception(ErrorUtility::GetFileNotFoundErrorMessage(pathReduce, true));
+	data->manager_ = this;
+	data->name_ = path;
+	data->bReady_ = false;
+	data->useMipMap_ = genMipmap;
+	data->useNonPowerOfTwo_ = flgNonPowerOfTwo;
+	data->type_ = TextureData::Type::TYPE_TEXTURE;
 
-						std::string source = reader->ReadAllString();
+	if (bLoadImageInfo) {
+		try {
+			shared_ptr<FileReader> reader = FileManager::GetBase()->GetFileReader(path);
+			if (reader == nullptr || !reader->Open())
+				throw wexception(ErrorUtility::GetFileNotFoundErrorMessage(pathReduce, true));
 
-						D3DXIMAGE_INFO info;
-						HRESULT hr = D3DXGetImageInfoFromFileInMemory(source.c_str(), source.size(), &info);
-						if (FAILED(hr))
-							throw wexception("D3DXGetImageInfoFromFileInMemory failure.");
+			std::string source = reader->ReadAllString();
 
-						data->infoImage_ = info;
-						data->CalculateResourceSize();
-					}
-					catch (wexception& e) {
-						std::wstring str = StringUtility::Format(
-							L"TextureManager(LT): Failed to load texture \"%s\"\r\n    %s", 
-							pathReduce.c_str(), e.what());
-						Logger::WriteTop(str);
-						data->bReady_ = true;
-
-						return nullptr;
-					}
-				}
+			D3DXIMAGE_INFO info;
+			HRESULT hr = D3DXGetImageInfoFromFileInMemory(source.c_str(), source.size(), &info);
+			if (FAILED(hr))
+				throw wexception("D3DXGetImageInfoFromFileInMemory failure.");
 
-				res->data_ = data;
-				mapTextureData_[path] = data;
-				{
-					shared_ptr<FileManager::LoadObject> source = res;
-					shared_ptr<FileManager::LoadThreadEvent> event(new FileManager::LoadThreadEvent(this, path, res));
-					FileManager::GetBase()->AddLoadThreadEvent(event);
-				}
-			}
+			data->infoImage_ = info;
+			data->CalculateResourceSize();
+		}
+		catch (wexception& e) {
+			std::wstring str = StringUtility::Format(
+				L"TextureManager(LT): Failed to load texture \"%s\"\r\n    %s", 
+				pathReduce.c_str(), e.what());
+			Logger::WriteTop(str);
+			data->bReady_ = true;
+
+			return nullptr;
 		}
 	}
+
+	{
+		Lock lock(lock_);
+
+		//Requested from elsewhere in the meantime
+		if (IsDataExists(path))
+			return res;
+
+		res->data_ = data;
+		mapTextureData_[path] = data;
+	}
+	_AddLoadQueue(res);
+
 	return res;
 }
 void TextureManager::CallFromLoadThread(shared_ptr<FileManager::LoadThreadEvent> event) {
-	const std::wstring& path = event->GetPath();
+	shared_ptr<Texture> texture = std::dynamic_pointer_cast<Texture>(event->GetSource());
+	if (texture == nullptr) return;
+	_LoadTextureData(texture);
+}
+void TextureManager::_AddLoadQueue(shared_ptr<Texture> texture) {
 	{
-		//Lock lock(lock_);
+		Lock lock(lockLoad_);
+		listLoadQueue_.push_back(texture);
+		++countLoadPending_;
+	}
+	signalLoad_.SetSignal();
+}
+void TextureManager::_LoadTextureData(shared_ptr<Texture> texture) {
+	shared_ptr<TextureData> data = texture->data_;
+	if (data == nullptr || data->bReady_) return;
+
+	long countRef = data.use_count();
+	if (countRef <= 2) {
+		data->bReady_ = true;
+		return;
+	}
 
-		shared_ptr<Texture> texture = std::dynamic_pointer_cast<Texture>(event->GetSource());
-		if (texture == nullptr) return;
+	std::wstring path = data->GetName();
+	std::wstring pathReduce = PathProperty::ReduceModuleDirectory(path);
+	try {
+		__CreateFromFile(data, path, data->useMipMap_, data->useNonPowerOfTwo_);
 
-		shared_ptr<TextureData> data = texture->data_;
-		if (data == nullptr || data->bReady_) return;
+		data->bReady_ = true;
 
-		long countRef = data.use_count();
-		if (countRef <= 2) {
-			data->bReady_ = true;
-			return;
+		Logger::WriteTop(StringUtility::Format(L"TextureManager(LT): Texture loaded. [%s]", pathReduce.c_str()));
+	}
+	catch (wexception& e) {
+		std::wstring str = StringUtility::Format(L"TextureManager(LT): Failed to load texture \"%s\"\r\n    %s",
+			pathReduce.c_str(), e.what());
+		Logger::WriteTop(str);
+		data->bReady_ = true;
+		texture->data_ = nullptr;
+		{
+			Lock lock(lock_);
+			mapTextureData_.erase(path);
 		}
+	}
+}
 
-		std::wstring pathReduce = PathProperty::ReduceModuleDirectory(path);
-		try {
-			__CreateFromFile(data, path, data->useMipMap_, data->useNonPowerOfTwo_);
-
-			data->bReady_ = true;
-
-			Logger::WriteTop(StringUtility::Format(L"TextureManager(LT): Texture loaded. [%s]", pathReduce.c_str()));
+//TextureManager::LoadWorker
+TextureManager::LoadWorker::LoadWorker(TextureManager* manager) {
+	_SetOuter(manager);
+}
+void TextureManager::LoadWorker::_Run() {
+	TextureManager* manager = _GetOuter();
+	while (this->GetStatus() == RUN) {
+		shared_ptr<Texture> texture;
+		{
+			Lock lock(manager->lockLoad_);
+			if (manager->listLoadQueue_.size() > 0) {
+				texture = manager->listLoadQueue_.front();
+				manager->listLoadQueue_.pop_front();
+
+				//The signal auto-resets, wake another worker for the rest of the queue
+				if (manager->listLoadQueue_.size() > 0)
+					manager->signalLoad_.SetSignal();
+			}
 		}
-		catch (wexception& e) {
-			std::wstring str = StringUtility::Format(L"TextureManager(LT): Failed to load texture \"%s\"\r\n    %s",
-				pathReduce.c_str(), e.what());
-			Logger::WriteTop(str);
-			data->bReady_ = true;
-			texture->data_ = nullptr;
-			mapTextureData_.erase(path);
+
+		if (texture == nullptr) {
+			manager->signalLoad_.Wait(INFINITE);
+			continue;
 		}
+
+		manager->_LoadTextureData(texture);
+		--manager->countLoadPending_;
 	}
+	manager->signalLoad_.SetSignal();
 }
 
 shared_ptr<TextureData> TextureManager::GetTextureData(const std::wstring& name) {
+	Lock lock(lock_);
 	auto itr = mapTextureData_.find(name);
 	if (itr != mapTextureData_.end())
 		return itr->second;
@@ -733,6 +977,7 @@ shared_ptr<TextureData> TextureManager::GetTextureData(const std::wstring& name)
 }
 
 shared_ptr<Texture> TextureManager::GetTexture(const std::wstring& name) {
+	Lock lock(lock_);
 	auto itr = mapTexture_.find(name);
 	if (itr != mapTexture_.end())
 		return itr->second;
@@ -764,6 +1009,7 @@ void TextureManager::Release(std::map<std::wstring, shared_ptr<Texture>>::iterat
 	}
 }
 bool TextureManager::IsDataExists(const std::wstring& name) {
+	Lock lock(lock_);
 	return mapTextureData_.find(name) != mapTextureData_.end();
 }
 std::map<std::wstring, shared_ptr<TextureData>>::iterator TextureManager::IsDataExistsItr(const std::wstring& name, bool* bRes) {
@@ -881,7 +1127,13 @@ void TextureInfoPanel::PanelUpdate() {
 		if (WindowLogger* logger = WindowLogger::GetParent()) {
 			shared_ptr<WStatusBar> statusBar = logger->GetStatusBar();
 			statusBar->SetText(0, L"Available Video Memory");
-			statusBar->SetText(1, StringUtility::Format(L"%u MB", texMem));
+			std::wstring text = StringUtility::Format(L"%u MB", texMem);
+			if (manager->GetImageCacheDirectory().size() > 0) {
+				text += StringUtility::Format(L"  (Image cache: %u hit, %u miss, %.2f s saved)",
+					(UINT)manager->GetImageCacheHitCount(), (UINT)manager->GetImageCacheMissCount(),
+					manager->GetImageCacheTimeSaved() / 1000000.0);
+			}
+			statusBar->SetText(1, text);
 		}
 	}
 }
@@ -97,7 +97,33 @@ namespace directx {
 		friend TextureInfoPanel;
 		static TextureManager* thisBase_;
 	public:
+		class LoadWorker;
+		friend LoadWorker;
+
 		static const std::wstring TARGET_TRANSITION;
+
+		enum {
+			MAX_LOAD_WORKER = 4,
+		};
+
+		//Level 0 of a decoded image, followed on disk by height * pitch bytes of pixels
+		struct ImageCacheHeader {
+			enum : uint32_t {
+				MAGIC = 0x43495844,		//"DXIC"
+				VERSION = 1,
+			};
+
+			uint32_t magic;
+			uint32_t version;
+			uint64_t sizeSource;
+			int64_t timeDecode;		//Microseconds
+
+			D3DXIMAGE_INFO infoImage;
+			D3DFORMAT format;
+			uint32_t width;
+			uint32_t height;
+			uint32_t pitch;
+		};
 	protected:
 		gstd::CriticalSection lock_;
 
@@ -106,9 +132,30 @@ namespace directx {
 		std::list<std::pair<std::map<std::wstring, shared_ptr<TextureData>>::iterator, IDirect3DSurface9*>> listRefreshSurface_;
 		shared_ptr<TextureInfoPanel> panelInfo_;
 
+		//Textures waiting to be decoded by the load workers
+		gstd::CriticalSection lockLoad_;
+		gstd::ThreadSignal signalLoad_;
+		std::list<shared_ptr<Texture>> listLoadQueue_;
+		std::atomic_size_t countLoadPending_;		//Queued and in progress
+		std::vector<unique_ptr<LoadWorker>> listLoadWorker_;
+
+		//Decoded image cache, disabled while the directory is empty
+		std::wstring pathImageCache_;
+		uint64_t sizeImageCacheMax_;				//Bytes, least recently used entries are removed past this
+		std::atomic_size_t countImageCacheHit_;
+		std::atomic_size_t countImageCacheMiss_;
+		std::atomic<int64_t> timeImageCacheSaved_;	//Microseconds
+
+		void _AddLoadQueue(shared_ptr<Texture> texture);
+		void _LoadTextureData(shared_ptr<Texture> texture);
+
 		void _ReleaseTextureData(const std::wstring& name);
 		void _ReleaseTextureData(std::map<std::wstring, shared_ptr<TextureData>>::iterator itr);
 
+		bool _LoadImageCache(shared_ptr<TextureData>& dst, const std::wstring& pathCache, size_t sizeSource);
+		void _SaveImageCache(shared_ptr<TextureData>& dst, const std::wstring& pathCache, size_t sizeSource, int64_t timeDecode);
+		void _TrimImageCache();
+
 		void __CreateFromFile(shared_ptr<TextureData>& dst, const std::wstring& path, bool genMipmap, bool flgNonPowerOfTwo);
 		bool _CreateFromFile(shared_ptr<TextureData>& dst, const std::wstring& path, bool genMipmap, bool flgNonPowerOfTwo);
 		bool _CreateRenderTarget(shared_ptr<TextureData>& dst, const std::wstring& name, 
@@ -145,8 +192,23 @@ namespace directx {
 		
 		shared_ptr<Texture> CreateFromFileInLoadThread(const std::wstring& path, bool genMipmap, bool flgNonPowerOfTwo, bool bLoadImageInfo = false);
 		virtual void CallFromLoadThread(shared_ptr<gstd::FileManager::LoadThreadEvent> event);
+		bool IsLoadComplete() { return countLoadPending_ == 0; }
 
 		void SetInfoPanel(shared_ptr<TextureInfoPanel> panel) { panelInfo_ = panel; }
+
+		void SetImageCacheDirectory(const std::wstring& dir) { pathImageCache_ = dir; }
+		const std::wstring& GetImageCacheDirectory() { return pathImageCache_; }
+		void SetImageCacheSizeMax(uint64_t size) { sizeImageCacheMax_ = size; }
+		size_t GetImageCacheHitCount() { return countImageCacheHit_; }
+		size_t GetImageCacheMissCount() { return countImageCacheMiss_; }
+		int64_t GetImageCacheTimeSaved() { return timeImageCacheSaved_; }
+	};
+	class TextureManager::LoadWorker : public gstd::Thread, public gstd::InnerClass<TextureManager> {
+		friend TextureManager;
+	protected:
+		LoadWorker(TextureManager* manager);
+
+		void _Run();
 	};
 
 	//****************************************************************************
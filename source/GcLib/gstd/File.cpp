@@ -1029,16 +1029,27 @@ void RecordBuffer::Read(Reader& reader) {
 	}
 }
 bool RecordBuffer::WriteToFile(const std::wstring& path, uint64_t version, const char* header, size_t headerSize) {
-	File file(path);
-	if (!file.Open(File::AccessType::WRITEONLY))
-		return false;
+	//Written to a temporary file first, so an interrupted write never leaves a truncated record behind
+	std::wstring pathTemp = path + L".tmp";
+	{
+		File file(pathTemp);
+		if (!file.Open(File::AccessType::WRITEONLY))
+			return false;
 
-	file.Write((LPVOID)header, headerSize);
-	file.Write(&version, sizeof(uint64_t));
-	Write(file);
-	file.Close();
+		file.Write((LPVOID)header, headerSize);
+		file.Write(&version, sizeof(uint64_t));
+		Write(file);
 
-	return true;
+		bool bGood = file.GetFileHandle().good();
+		file.Close();
+		if (!bGood) {
+			::DeleteFileW(pathTemp.c_str());
+			return false;
+		}
+	}
+
+	return ::MoveFileExW(pathTemp.c_str(), path.c_str(), 
+		MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
 }
 bool RecordBuffer::ReadFromFile(const std::wstring& path, uint64_t version, const char* header, size_t headerSize) {
 	File file(path);
@@ -1114,6 +1125,9 @@ void RecordBuffer::SetRecord(const std::string& key, LPVOID buf, DWORD size) {
 	buffer.Write(buf, size);
 	mapEntry_[key] = entry;
 }
+void RecordBuffer::SetRecordEntry(shared_ptr<RecordEntry> entry) {
+	mapEntry_[entry->GetKey()] = entry;
+}
 void RecordBuffer::SetRecordAsRecordBuffer(const std::string& key, RecordBuffer& record) {
 	shared_ptr<RecordEntry> entry(new RecordEntry());
 	entry->SetKey(key);
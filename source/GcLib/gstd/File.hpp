@@ -469,6 +469,7 @@ namespace gstd {
 			SetRecord(key, (LPVOID)mbstr.c_str(), mbstr.size() * sizeof(char));
 		}
 		void SetRecordAsRecordBuffer(const std::string& key, RecordBuffer& record);
+		void SetRecordEntry(shared_ptr<RecordEntry> entry);
 
 		//Recordable
 		virtual void Read(RecordBuffer& record);
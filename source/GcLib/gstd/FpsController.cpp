@@ -6,6 +6,40 @@
 using namespace gstd;
 using namespace stdch;
 
+//*******************************************************************
+//FrameTimeHistory
+//*******************************************************************
+void FrameTimeHistory::Clear() {
+	pos_ = 0;
+	count_ = 0;
+	sumPending_ = 0;
+	countPending_ = 0;
+}
+void FrameTimeHistory::Push(double ms) {
+	buffer_[pos_] = ms;
+	pos_ = (pos_ + 1) % CAPACITY;
+	count_ = std::min<size_t>(count_ + 1, CAPACITY);
+
+	sumPending_ += ms;
+	++countPending_;
+}
+double FrameTimeHistory::FlushAverage() {
+	double res = countPending_ > 0 ? sumPending_ / countPending_ : 0;
+	sumPending_ = 0;
+	countPending_ = 0;
+	return res;
+}
+double FrameTimeHistory::GetPercentile(double p) {
+	if (count_ == 0) return 0;
+
+	std::array<float, CAPACITY> sorted;
+	std::copy(buffer_.begin(), buffer_.begin() + count_, sorted.begin());
+
+	size_t index = std::min((size_t)(p * count_), count_ - 1);
+	std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + count_);
+	return sorted[index];
+}
+
 //*******************************************************************
 //FpsController
 //*******************************************************************
@@ -16,8 +50,44 @@ FpsController::FpsController() {
 
 	bFastMode_ = false;
 	fastModeFpsRate_ = 1200;
+
+	bPacing_ = false;
+	timeSpinBudget_ = 0ns;
+
+	frameTimeP50_ = 0;
+	frameTimeP99_ = 0;
 }
 FpsController::~FpsController() {
+	if (bPacing_)
+		::timeEndPeriod(1);
+}
+void FpsController::SetPacing(bool bEnable, nanoseconds spin) {
+	//Sleep() is only accurate to the system timer period, 15.6ms by default
+	if (bEnable && !bPacing_)
+		::timeBeginPeriod(1);
+	else if (!bEnable && bPacing_)
+		::timeEndPeriod(1);
+
+	bPacing_ = bEnable;
+	timeSpinBudget_ = std::max(spin, 0ns);
+}
+void FpsController::_WaitUntil(const steady_clock::time_point& time) {
+	auto timeRemain = time - SystemUtility::GetCpuTime();
+	if (timeRemain <= 0ns) return;
+
+	//Sleep coarsely, leaving the spin budget to absorb the scheduler's wakeup jitter
+	if (timeRemain > timeSpinBudget_) {
+		auto timeSleep = duration_cast<milliseconds>(timeRemain - timeSpinBudget_);
+		if (timeSleep.count() > 0)
+			::Sleep((DWORD)timeSleep.count());
+	}
+
+	while (SystemUtility::GetCpuTime() < time)
+		::YieldProcessor();
+}
+void FpsController::_UpdateFrameTimePercentile(FrameTimeHistory& history) {
+	frameTimeP50_ = history.GetPercentile(0.5);
+	frameTimeP99_ = history.GetPercentile(0.99);
 }
 void FpsController::RemoveFpsControlObject(ref_count_weak_ptr<FpsControlObject> obj) {
 	if (obj.expired()) return;
@@ -69,6 +139,9 @@ std::array<bool, 2> StaticFpsController::Advance() {
 	DWORD fpsTarget = std::min<DWORD>(bFastMode_ ? fastModeFpsRate_ : std::min(fps_, GetControlObjectFps()), 1000);
 	const auto targetNs = duration<double, std::nano>(std::nano::den / (double)fpsTarget);
 
+	if (bPacing_)
+		_WaitUntil(timePrevious_ + duration_cast<nanoseconds>(targetNs - timeAccum_));
+
 	auto timeCurrent = SystemUtility::GetCpuTime();
 	auto timeDelta = timeCurrent - timePrevious_;
 	timePrevious_ = timeCurrent;
@@ -76,7 +149,7 @@ std::array<bool, 2> StaticFpsController::Advance() {
 	timeAccum_ += timeDelta;
 	if (timeAccum_ >= targetNs) {
 		if (bCriticalFrame_ || (rateSkip_ <= 1 || countSkip_ % rateSkip_ == 0)) {
-			listFps_.push_back(timeAccum_.count());
+			historyFrame_.Push(timeAccum_.count() / 1e6);
 			res[0] = true;
 		}
 		res[1] = true;
@@ -90,17 +163,12 @@ std::array<bool, 2> StaticFpsController::Advance() {
 	}
 
 	if (timeCurrent - timePreviousFpsUpdate_ >= 500ms) {
-		if (listFps_.size() > 0) {
-			double fpsAccum = 0;		//ms
-			for (double iFps : listFps_)
-				fpsAccum += iFps / 1e6;
-			fpsAccum /= listFps_.size();
-
+		if (historyFrame_.GetPendingCount() > 0) {
+			double fpsAccum = historyFrame_.FlushAverage();		//ms
 			fpsCurrent_ = 1000 / fpsAccum;
-
-			listFps_.clear();
 		}
 		else fpsCurrent_ = 0;
+		_UpdateFrameTimePercentile(historyFrame_);
 
 		timePreviousFpsUpdate_ = timePrevious_;
 	}
@@ -143,6 +211,9 @@ std::array<bool, 2> VariableFpsController::Advance() {
 	DWORD fpsTarget = std::min<DWORD>(bFastMode_ ? fastModeFpsRate_ : std::min(fps_, GetControlObjectFps()), 1000);
 	const auto targetNs = duration<double, std::nano>(std::nano::den / (double)fpsTarget);
 
+	if (bPacing_)
+		_WaitUntil(timePrevious_ + duration_cast<nanoseconds>(targetNs - timeAccumUpdate_));
+
 	auto timeCurrent = SystemUtility::GetCpuTime();
 	auto timeDelta = timeCurrent - timePrevious_;
 	timePrevious_ = timeCurrent;
@@ -151,7 +222,7 @@ std::array<bool, 2> VariableFpsController::Advance() {
 	timeAccumRender_ += timeDelta;
 
 	if (timeAccumUpdate_ >= targetNs) {
-		listFpsUpdate_.push_back(timeAccumUpdate_.count());
+		historyUpdate_.Push(timeAccumUpdate_.count() / 1e6);
 		res[1] = true;
 
 		const nanoseconds dCast = duration_cast<nanoseconds>(targetNs);
@@ -166,7 +237,7 @@ std::array<bool, 2> VariableFpsController::Advance() {
 	if (bCriticalFrame_ || (!bFrameRendered_ && (countSkip_ >= MAX_SKIP || timeAccumRender_ < targetNs))) {
 		auto timeDeltaRender = timeCurrent - timePreviousRender_;
 
-		listFpsRender_.push_back(timeDeltaRender.count());
+		historyRender_.Push(duration<double, std::milli>(timeDeltaRender).count());
 		res[0] = true;
 
 		timePreviousRender_ = timeCurrent;
@@ -179,31 +250,24 @@ std::array<bool, 2> VariableFpsController::Advance() {
 	timeAccumRender_ = 0ns;
 
 	if (timeCurrent - timePreviousFpsUpdate_ >= 500ms) {
-		if (listFpsUpdate_.size() > 0) {
-			double fpsAccum = 0;		//ms
-			for (double iFps : listFpsUpdate_)
-				fpsAccum += iFps / 1e6;
-			fpsAccum /= listFpsUpdate_.size();
-
+		size_t countUpdate = historyUpdate_.GetPendingCount();
+		if (countUpdate > 0) {
+			double fpsAccum = historyUpdate_.FlushAverage();	//ms
 			fpsCurrentUpdate_ = 1000 / fpsAccum;
 		}
 		else fpsCurrentUpdate_ = 0;
+		_UpdateFrameTimePercentile(historyUpdate_);
 
 		/*
-		if (listFpsRender_.size() > 0) {
-			double fpsAccum = 0;		//ms
-			for (double iFps : listFpsRender_)
-				fpsAccum += iFps / 1e6;
-			fpsAccum /= listFpsRender_.size();
-
+		if (historyRender_.GetPendingCount() > 0) {
+			double fpsAccum = historyRender_.FlushAverage();	//ms
 			fpsCurrentRender_ = std::max(1000 / fpsAccum - 2, 0.0);
 		}
 		else fpsCurrentRender_ = 0;
 		*/
-		fpsCurrentRender_ = listFpsUpdate_.size();	//TODO: Figure out how to calculate this
+		fpsCurrentRender_ = countUpdate;	//TODO: Figure out how to calculate this
 
-		listFpsUpdate_.clear();
-		listFpsRender_.clear();
+		historyRender_.FlushAverage();
 		timePreviousFpsUpdate_ = timePrevious_;
 	}
 
@@ -6,6 +6,36 @@
 
 namespace gstd {
 	class FpsControlObject;
+	//*******************************************************************
+	//FrameTimeHistory
+	//*******************************************************************
+	class FrameTimeHistory {
+	public:
+		enum : size_t {
+			CAPACITY = 256,
+		};
+	private:
+		std::array<float, CAPACITY> buffer_;	//ms
+		size_t pos_;
+		size_t count_;
+
+		double sumPending_;
+		size_t countPending_;
+	public:
+		FrameTimeHistory() { Clear(); }
+
+		void Clear();
+		void Push(double ms);
+
+		size_t GetCount() { return count_; }
+		size_t GetPendingCount() { return countPending_; }
+
+		//Average of the entries pushed since the last call, or 0 if there were none
+		double FlushAverage();
+		//p in [0, 1]
+		double GetPercentile(double p);
+	};
+
 	//*******************************************************************
 	//FpsController
 	//*******************************************************************
@@ -18,11 +48,25 @@ namespace gstd {
 
 		size_t fastModeFpsRate_;
 
+		bool bPacing_;
+		stdch::nanoseconds timeSpinBudget_;
+
+		float frameTimeP50_;
+		float frameTimeP99_;
+
 		std::list<ref_count_weak_ptr<FpsControlObject>> listFpsControlObject_;
+
+		void _WaitUntil(const stdch::steady_clock::time_point& time);
+		void _UpdateFrameTimePercentile(FrameTimeHistory& history);
 	public:
 		FpsController();
 		virtual ~FpsController();
 
+		//Sleeps until the next frame is due, spinning for the last [spin] of it.
+		//When disabled, Advance returns immediately and the caller polls.
+		void SetPacing(bool bEnable, stdch::nanoseconds spin);
+		bool IsPacing() { return bPacing_; }
+
 		virtual void SetFps(DWORD fps) { fps_ = fps; }
 		virtual DWORD GetFps() { return fps_; }
 
@@ -47,6 +91,10 @@ namespace gstd {
 		}
 		void RemoveFpsControlObject(ref_count_weak_ptr<FpsControlObject> obj);
 		DWORD GetControlObjectFps();
+
+		//Frame times in ms, refreshed along with the current fps
+		float GetFrameTimeP50() { return frameTimeP50_; }
+		float GetFrameTimeP99() { return frameTimeP99_; }
 	};
 
 	//*******************************************************************
@@ -64,7 +112,7 @@ namespace gstd {
 		stdch::nanoseconds timeAccum_;
 
 		stdch::steady_clock::time_point timePreviousFpsUpdate_;
-		std::list<double> listFps_;
+		FrameTimeHistory historyFrame_;
 	public:
 		StaticFpsController();
 		virtual ~StaticFpsController();
@@ -101,8 +149,8 @@ namespace gstd {
 		stdch::nanoseconds timeAccumRender_;
 
 		stdch::steady_clock::time_point timePreviousFpsUpdate_;
-		std::list<double> listFpsUpdate_;
-		std::list<double> listFpsRender_;
+		FrameTimeHistory historyUpdate_;
+		FrameTimeHistory historyRender_;
 	public:
 		VariableFpsController();
 		virtual ~VariableFpsController();
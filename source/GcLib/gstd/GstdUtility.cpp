@@ -633,6 +633,29 @@ std::wstring StringUtility::FormatToWide(const char* str, ...) {
 	va_end(vl);
 	return StringUtility::ConvertMultiToWide(res);
 }
+void StringUtility::AppendInteger(std::wstring& dst, int64_t num) {
+	wchar_t buf[24];
+	wchar_t* pEnd = buf + 24;
+	wchar_t* pos = pEnd;
+
+	uint64_t mag = num < 0 ? (0ULL - (uint64_t)num) : (uint64_t)num;
+	do {
+		*(--pos) = L'0' + (wchar_t)(mag % 10U);
+		mag /= 10U;
+	} while (mag > 0);
+	if (num < 0) *(--pos) = L'-';
+
+	dst.append(pos, pEnd);
+}
+void StringUtility::AppendFloat(std::wstring& dst, double num) {
+	//"%f" of DBL_MAX is 316 characters
+	wchar_t buf[384];
+	int size = _snwprintf(buf, 384U, L"%f", num);
+	if (size >= 0 && size < 384)
+		dst.append(buf, size);
+	else
+		dst += std::to_wstring(num);
+}
 
 size_t StringUtility::CountCharacter(const std::wstring& str, wchar_t c) {
 	size_t count = 0;
@@ -222,6 +222,10 @@ namespace gstd {
 		static std::wstring Format(const wchar_t* str, va_list va);
 		static std::wstring FormatToWide(const char* str, ...);
 
+		//Same output as std::to_wstring, appended without temporary strings
+		static void AppendInteger(std::wstring& dst, int64_t num);
+		static void AppendFloat(std::wstring& dst, double num);
+
 		static size_t CountCharacter(const std::wstring& str, wchar_t c);
 
 		static int ToInteger(const std::wstring& s);
@@ -622,6 +626,27 @@ namespace gstd {
 		}
 	};
 
+	//================================================================
+	//HashUtility
+	//64-bit FNV-1a, for fingerprints that must stay the same between runs
+	class HashUtility {
+	public:
+		static constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ui64;
+		static constexpr uint64_t FNV_PRIME = 0x00000100000001b3ui64;
+
+		static uint64_t Fnv1a(const void* data, size_t size, uint64_t hash = FNV_OFFSET) {
+			const byte* ptr = (const byte*)data;
+			for (size_t i = 0; i < size; ++i) {
+				hash ^= ptr[i];
+				hash *= FNV_PRIME;
+			}
+			return hash;
+		}
+		template<typename T> static uint64_t Combine(uint64_t hash, const T& data) {
+			return Fnv1a(&data, sizeof(T), hash);
+		}
+	};
+
 #if defined(DNH_PROJ_EXECUTOR)
 	//================================================================
 	//IStringInfo
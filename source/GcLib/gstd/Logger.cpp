@@ -61,10 +61,23 @@ void Logger::FlushFileLogger() {
 //FileLogger
 //*******************************************************************
 FileLogger::FileLogger() {
+	bEnable_ = false;
 	sizeMax_ = 10 * 1024 * 1024;//10MB
+
+	sizeBufferMax_ = DEFAULT_BUFFER_SIZE;
+	countPending_ = 0;
+
+	countWritten_ = 0;
+	countDropped_ = 0;
 }
 FileLogger::~FileLogger() {
-	file_->Close();
+	if (threadWriter_) {
+		threadWriter_->Stop();
+		signalWrite_.SetSignal();
+		threadWriter_->Join(2000);
+	}
+	_WriteBatch(false);
+	if (file_) file_->Close();
 }
 bool FileLogger::Initialize(bool bEnable) {
 	return this->Initialize(L"", bEnable);
@@ -81,10 +94,22 @@ bool FileLogger::Initialize(std::wstring path, bool bEnable) {
 bool FileLogger::SetPath(const std::wstring& path) {
 	if (!bEnable_) return false;
 
-	path_ = path;
-	File::CreateFileDirectory(path_);
+	//Anything still pending belongs to the old file
+	_WriteBatch(true);
+
+	{
+		Lock lock(lockFile_);
+
+		path_ = path;
+		File::CreateFileDirectory(path_);
 
-	_CreateFile();
+		_CreateFile();
+	}
+
+	if (threadWriter_ == nullptr) {
+		threadWriter_.reset(new WriterThread(this));
+		threadWriter_->Start();
+	}
 
 	return true;
 }
@@ -98,26 +123,89 @@ void FileLogger::_CreateFile() {
 }
 void FileLogger::FlushFile() {
 	if (!bEnable_) return;
-	if (file_->IsOpen()) {
-		std::fstream& hFile = file_->GetFileHandle();
-		hFile.flush();
-	}
+	_WriteBatch(true);
+}
+void FileLogger::SetMaxBufferSize(size_t size) {
+	Lock lock(lock_);
+	sizeBufferMax_ = size;
+}
+uint64_t FileLogger::GetWrittenCount() {
+	Lock lock(lock_);
+	return countWritten_;
+}
+uint64_t FileLogger::GetDroppedCount() {
+	Lock lock(lock_);
+	return countDropped_;
 }
 void FileLogger::_Write(SYSTEMTIME& time, const std::wstring& str) {
 	if (!bEnable_) return;
 
-	if (file_->IsOpen()) {
+	wchar_t strTime[32];
+	int sizeTime = _snwprintf(strTime, 32U,
+		//L"%.4d/%.2d/%.2d "
+		L"%.2d:%.2d:%.2d.%.3d ", 
+		//time.wYear, time.wMonth, time.wDay, 
+		time.wHour, time.wMinute, time.wSecond, time.wMilliseconds);
+	if (sizeTime < 0) sizeTime = 0;
+
+	bool bWasEmpty = false;
+	{
+		Lock lock(lock_);
+
+		size_t sizeRecord = sizeTime + str.size() + 1U;
+		if (bufferPending_.size() + sizeRecord > sizeBufferMax_) {
+			++countDropped_;
+			return;
+		}
+
+		bWasEmpty = bufferPending_.size() == 0;
+		bufferPending_.append(strTime, sizeTime);
+		bufferPending_.append(str);
+		bufferPending_ += L'\n';
+		++countPending_;
+	}
+
+	//The writer also wakes up on its own every WRITE_INTERVAL, no need to signal per record
+	if (bWasEmpty)
+		signalWrite_.SetSignal();
+}
+void FileLogger::_WriteBatch(bool bFlush) {
+	Lock lockFile(lockFile_);
+
+	size_t countBatch = 0;
+	{
+		Lock lock(lock_);
+		bufferWriting_.swap(bufferPending_);
+		countBatch = countPending_;
+		countPending_ = 0;
+	}
+
+	if (file_ == nullptr || !file_->IsOpen()) {
+		bufferWriting_.clear();
+		return;
+	}
+
+	if (bufferWriting_.size() > 0) {
+		file_->Write((wchar_t*)bufferWriting_.data(), StringUtility::GetByteSize(bufferWriting_));
+		bufferWriting_.clear();
+
 		Lock lock(lock_);
+		countWritten_ += countBatch;
+	}
+	if (bFlush) {
+		std::fstream& hFile = file_->GetFileHandle();
+		hFile.flush();
+	}
+}
 
-		std::wstring strTime = StringUtility::Format(
-			//L"%.4d/%.2d/%.2d "
-			L"%.2d:%.2d:%.2d.%.3d ", 
-			//time.wYear, time.wMonth, time.wDay, 
-			time.wHour, time.wMinute, time.wSecond, time.wMilliseconds);
-		
-		file_->Write(strTime.data(), StringUtility::GetByteSize(strTime));
-		file_->Write((wchar_t*)str.data(), StringUtility::GetByteSize(str));
-		file_->Write(L"\n", sizeof(wchar_t));
+FileLogger::WriterThread::WriterThread(FileLogger* logger) {
+	_SetOuter(logger);
+}
+void FileLogger::WriterThread::_Run() {
+	FileLogger* logger = _GetOuter();
+	while (this->GetStatus() == RUN) {
+		logger->signalWrite_.Wait(WRITE_INTERVAL);
+		logger->_WriteBatch(false);
 	}
 }
 
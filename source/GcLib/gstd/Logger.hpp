@@ -42,6 +42,16 @@ namespace gstd {
 	//FileLogger
 	//*******************************************************************
 	class FileLogger : public Logger {
+	public:
+		class WriterThread;
+		friend WriterThread;
+
+		enum : size_t {
+			DEFAULT_BUFFER_SIZE = 1024U * 1024U,	//In characters, per buffer
+		};
+		enum : DWORD {
+			WRITE_INTERVAL = 250U,	//ms
+		};
 	protected:
 		bool bEnable_;
 
@@ -50,8 +60,23 @@ namespace gstd {
 
 		size_t sizeMax_;
 
+		//Records are formatted by the logging thread into bufferPending_ under lock_,
+		//	the writer thread swaps it out and writes each batch with a single call
+		std::wstring bufferPending_;
+		std::wstring bufferWriting_;
+		size_t sizeBufferMax_;
+		size_t countPending_;
+
+		uint64_t countWritten_;
+		uint64_t countDropped_;
+
+		gstd::CriticalSection lockFile_;
+		gstd::ThreadSignal signalWrite_;
+		unique_ptr<WriterThread> threadWriter_;
+
 		virtual void _Write(SYSTEMTIME& systemTime, const std::wstring& str);
 		void _CreateFile();
+		void _WriteBatch(bool bFlush);
 	public:
 		FileLogger();
 		~FileLogger();
@@ -63,6 +88,19 @@ namespace gstd {
 		
 		bool SetPath(const std::wstring& path);
 		void SetMaxFileSize(int size) { sizeMax_ = size; }
+
+		//Records that would grow the pending buffer past this are dropped
+		void SetMaxBufferSize(size_t size);
+
+		uint64_t GetWrittenCount();
+		uint64_t GetDroppedCount();
+	};
+	class FileLogger::WriterThread : public gstd::Thread, public gstd::InnerClass<FileLogger> {
+		friend FileLogger;
+	protected:
+		WriterThread(FileLogger* logger);
+
+		void _Run();
 	};
 
 	//*******************************************************************
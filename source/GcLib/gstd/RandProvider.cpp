@@ -102,4 +102,36 @@ double RandProvider::GetReal() {
 double RandProvider::GetReal(double a, double b) {
 	if (a == b) return a;
 	return (a + GetReal() * (b - a));
-}
\ No newline at end of file
+}
+void RandProvider::Fill(double* dst, size_t count, double a, double b) {
+	if (a == b) {
+		std::fill(dst, dst + count, a);
+		return;
+	}
+
+	//Keep the state in locals for the duration of the loop
+	uint64_t s0 = states_[0];
+	uint64_t s1 = states_[1];
+	uint64_t s2 = states_[2];
+	uint64_t s3 = states_[3];
+
+	const double range = b - a;
+	for (size_t i = 0; i < count; ++i) {
+		uint64_t result = rotl(s1 * 5ui64, 7U) * 9ui64;
+
+		uint64_t t = s1 << 17U;
+		s2 ^= s0;
+		s3 ^= s1;
+		s1 ^= s2;
+		s0 ^= s3;
+		s2 ^= t;
+		s3 = rotl(s3, 45U);
+
+		dst[i] = a + (double)(result * (1.0 / (double)UINT64_MAX)) * range;
+	}
+
+	states_[0] = s0;
+	states_[1] = s1;
+	states_[2] = s2;
+	states_[3] = s3;
+}
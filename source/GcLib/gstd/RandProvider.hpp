@@ -69,11 +69,17 @@ namespace gstd {
 		void Initialize(uint32_t s);
 
 		uint32_t GetSeed() { return seed_; }
+		const uint64_t* GetState() { return states_; }
+		void SetState(const uint64_t* states) { memcpy(states_, states, sizeof(states_)); }
+
 		int GetInt();
 		int GetInt(int min, int max);
 		int64_t GetInt64();
 		int64_t GetInt64(int64_t min, int64_t max);
 		double GetReal();
 		double GetReal(double min, double max);
+
+		//Same sequence as calling GetReal(min, max) count times
+		void Fill(double* dst, size_t count, double min, double max);
 	};
 }
\ No newline at end of file
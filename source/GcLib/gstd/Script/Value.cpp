@@ -59,11 +59,15 @@ value::value(type_data* t, bool v) {
 value::value(type_data* t, value* v) {
 	this->set(t, v);
 }
-value::value(type_data* t, const std::wstring& v) {
-	std::vector<value> vec(v.size());
-	for (size_t i = 0; i < v.size(); ++i)
-		vec[i] = value(t->get_element(), v[i]);
-	this->set(t, vec);
+value::value(type_data* t, const std::wstring& v) : value(t, v.data(), v.size()) {
+}
+value::value(type_data* t, const wchar_t* v, size_t length) {
+	//Build the element array in place, set(t, vector&) would copy it once more
+	type_data* elem = t->get_element();
+	ref_unsync_ptr<std::vector<value>> arr = new std::vector<value>(length);
+	for (size_t i = 0; i < length; ++i)
+		(*arr)[i].set(elem, v[i]);
+	this->set(t, arr);
 }
 value::~value() {
 	this->release();
@@ -314,39 +318,56 @@ bool value::as_boolean() const {
 	return false;
 }
 std::wstring value::as_string() const {
-	if (!has_data()) return L"(NULL)";
-	if (kind == type_data::tk_float)
-		return std::to_wstring(float_value);
-	if (kind == type_data::tk_int)
-		return std::to_wstring(int_value);
-	if (kind == type_data::tk_boolean)
-		return boolean_value ? L"true" : L"false";
-	if (kind == type_data::tk_char)
-		return std::wstring(&char_value, 1);
-	if (kind == type_data::tk_pointer)
-		return StringUtility::Format(L"%08x", (uint32_t)ptr_value);
-	if (kind == type_data::tk_array) {
-		std::wstring result = L"";
-		if (type_data* elem = type->get_element()) {
-			if (elem->get_kind() == type_data::tk_char) {
-				for (auto itr = p_array_value->begin(); itr != p_array_value->end(); ++itr)
-					result += itr->as_char();
-			}
-			else {
-				result = L"[";
-				auto itr = p_array_value->begin();
-				while (itr != p_array_value->end()) {
-					result += itr->as_string();
-					if ((++itr) == p_array_value->end()) break;
-					result += L",";
-				}
-				result += L"]";
+	std::wstring result;
+	append_string(result);
+	return result;
+}
+void value::append_string(std::wstring& dst) const {
+	if (!has_data()) {
+		dst += L"(NULL)";
+		return;
+	}
+	switch (kind) {
+	case type_data::tk_float:
+		StringUtility::AppendFloat(dst, float_value);
+		return;
+	case type_data::tk_int:
+		StringUtility::AppendInteger(dst, int_value);
+		return;
+	case type_data::tk_boolean:
+		dst += boolean_value ? L"true" : L"false";
+		return;
+	case type_data::tk_char:
+		dst += char_value;
+		return;
+	case type_data::tk_pointer:
+		dst += StringUtility::Format(L"%08x", (uint32_t)ptr_value);
+		return;
+	case type_data::tk_array:
+	{
+		type_data* elem = type->get_element();
+		if (elem == nullptr) {
+			dst += L"[]";
+		}
+		else if (elem->get_kind() == type_data::tk_char) {
+			dst.reserve(dst.size() + p_array_value->size());
+			for (auto itr = p_array_value->begin(); itr != p_array_value->end(); ++itr)
+				dst += itr->as_char();
+		}
+		else {
+			dst += L'[';
+			auto itr = p_array_value->begin();
+			while (itr != p_array_value->end()) {
+				itr->append_string(dst);
+				if ((++itr) == p_array_value->end()) break;
+				dst += L',';
 			}
+			dst += L']';
 		}
-		else result = L"[]";
-		return result;
+		return;
+	}
 	}
-	return L"(INVALID-TYPE)";
+	dst += L"(INVALID-TYPE)";
 }
 ref_unsync_ptr<std::vector<value>> value::as_array_ptr() const {
 	if (!has_data()) return nullptr;
@@ -56,6 +56,7 @@ namespace gstd {
 		value(type_data* t, bool v);
 		value(type_data* t, value* v);
 		value(type_data* t, const std::wstring& v);
+		value(type_data* t, const wchar_t* v, size_t length);
 		value(const value& source) {
 			*this = source;
 		}
@@ -109,6 +110,7 @@ namespace gstd {
 		bool as_boolean() const;
 		value* as_ptr() const { return ptr_value; }
 		std::wstring as_string() const;
+		void append_string(std::wstring& dst) const;
 
 		ref_unsync_ptr<std::vector<value>> as_array_ptr() const;
 	};
@@ -44,6 +44,289 @@ bool ScriptEngineCache::IsExists(const std::wstring& name) {
 	return cache_.find(name) != cache_.end();
 }
 
+//****************************************************************************
+//ScriptRegexCache
+//****************************************************************************
+ScriptRegexCache::ScriptRegexCache() {
+	capacity_ = DEFAULT_CAPACITY;
+}
+void ScriptRegexCache::Clear() {
+	mapEntry_.clear();
+	listEntry_.clear();
+}
+void ScriptRegexCache::SetCapacity(size_t capacity) {
+	capacity_ = std::max<size_t>(capacity, 1U);
+	while (listEntry_.size() > capacity_) {
+		mapEntry_.erase(listEntry_.back().first);
+		listEntry_.pop_back();
+	}
+}
+const std::wregex& ScriptRegexCache::Get(const std::wstring& pattern, Flags flags) {
+	Key key(pattern, flags);
+
+	auto itrFind = mapEntry_.find(key);
+	if (itrFind != mapEntry_.end()) {
+		//Move to the front
+		listEntry_.splice(listEntry_.begin(), listEntry_, itrFind->second);
+		return itrFind->second->second;
+	}
+
+	std::wregex reg(pattern, flags);
+	if (listEntry_.size() >= capacity_) {
+		mapEntry_.erase(listEntry_.back().first);
+		listEntry_.pop_back();
+	}
+	listEntry_.emplace_front(key, std::move(reg));
+	mapEntry_[key] = listEntry_.begin();
+	return listEntry_.front().second;
+}
+
+//****************************************************************************
+//ScriptFormatCache
+//****************************************************************************
+ScriptFormatCache::ScriptFormatCache() {
+	capacity_ = DEFAULT_CAPACITY;
+}
+void ScriptFormatCache::Clear() {
+	mapTemplate_.clear();
+}
+void ScriptFormatCache::SetCapacity(size_t capacity) {
+	capacity_ = std::max<size_t>(capacity, 1U);
+	if (mapTemplate_.size() > capacity_)
+		mapTemplate_.clear();
+}
+const ScriptFormatCache::Template& ScriptFormatCache::Get(const std::wstring& format) {
+	auto itrFind = mapTemplate_.find(format);
+	if (itrFind != mapTemplate_.end())
+		return itrFind->second;
+
+	//Scripts rarely use more than a handful of distinct templates, just start over when full
+	if (mapTemplate_.size() >= capacity_)
+		mapTemplate_.clear();
+
+	Template& res = mapTemplate_[format];
+	_Parse(res, format);
+	return res;
+}
+void ScriptFormatCache::_Parse(Template& res, const std::wstring& format) {
+	enum {
+		LEN_NONE, LEN_H, LEN_HH, LEN_L, LEN_LL, LEN_BIG_L,
+		LEN_I32, LEN_I64, LEN_W, LEN_OTHER,
+	};
+
+	res.bSupported = false;
+	res.text.clear();
+	res.listSegment.clear();
+
+	size_t posLiteral = 0;
+	auto _FlushLiteral = [&]() {
+		if (res.text.size() > posLiteral)
+			res.listSegment.push_back({ SegmentType::Literal, false, posLiteral, res.text.size() - posLiteral });
+	};
+
+	//Like the CRT, stop at the first null character
+	const wchar_t* pos = format.c_str();
+	while (*pos != L'\0') {
+		if (*pos != L'%') {
+			res.text += *(pos++);
+			continue;
+		}
+		if (pos[1] == L'%') {
+			res.text += L'%';
+			pos += 2;
+			continue;
+		}
+
+		const wchar_t* pSpec = pos++;
+		bool bDecorated = false;
+
+		//Flags, width, precision; '*' falls through as an unsupported conversion
+		while (*pos == L'-' || *pos == L'+' || *pos == L' ' || *pos == L'0' || *pos == L'#') {
+			++pos;
+			bDecorated = true;
+		}
+		while (*pos >= L'0' && *pos <= L'9') {
+			++pos;
+			bDecorated = true;
+		}
+		if (*pos == L'.') {
+			++pos;
+			bDecorated = true;
+			while (*pos >= L'0' && *pos <= L'9') ++pos;
+		}
+
+		int len = LEN_NONE;
+		switch (*pos) {
+		case L'h':
+			len = pos[1] == L'h' ? LEN_HH : LEN_H;
+			pos += len == LEN_HH ? 2 : 1;
+			break;
+		case L'l':
+			len = pos[1] == L'l' ? LEN_LL : LEN_L;
+			pos += len == LEN_LL ? 2 : 1;
+			break;
+		case L'L':
+			len = LEN_BIG_L;
+			++pos;
+			break;
+		case L'I':
+			if (pos[1] == L'3' && pos[2] == L'2') len = LEN_I32;
+			else if (pos[1] == L'6' && pos[2] == L'4') len = LEN_I64;
+			else return;
+			pos += 3;
+			break;
+		case L'w':
+			len = LEN_W;
+			++pos;
+			break;
+		case L'j':
+		case L'z':
+		case L't':
+			return;
+		}
+
+		wchar_t conv = *pos;
+		SegmentType type = SegmentType::Literal;
+		bool bPlain = false;
+		switch (conv) {
+		case L'd': case L'i':
+		case L'o': case L'u': case L'x': case L'X':
+		{
+			bool bDecimal = conv == L'd' || conv == L'i';
+			if (len == LEN_NONE || len == LEN_H || len == LEN_HH || len == LEN_L || len == LEN_I32) {
+				type = SegmentType::Int;
+				bPlain = bDecimal && !bDecorated && len == LEN_NONE;
+			}
+			else if (len == LEN_LL || len == LEN_I64) {
+				type = SegmentType::Int64;
+				bPlain = bDecimal && !bDecorated;
+			}
+			break;
+		}
+		case L'c':
+			if (len == LEN_NONE || len == LEN_L || len == LEN_W)
+				type = SegmentType::Int;
+			break;
+		case L'e': case L'E': case L'f': case L'F':
+		case L'g': case L'G': case L'a': case L'A':
+			if (len == LEN_NONE || len == LEN_L || len == LEN_BIG_L)
+				type = SegmentType::Float;
+			break;
+		case L's':
+			if (len == LEN_NONE || len == LEN_L || len == LEN_W) {
+				type = SegmentType::String;
+				bPlain = !bDecorated;
+			}
+			break;
+		}
+		if (type == SegmentType::Literal) return;
+		++pos;
+
+		_FlushLiteral();
+		res.listSegment.push_back({ type, bPlain, res.text.size(), (size_t)(pos - pSpec) });
+		res.text.append(pSpec, pos);
+		res.text += L'\0';
+		posLiteral = res.text.size();
+	}
+	_FlushLiteral();
+
+	res.bSupported = true;
+}
+
+template<typename T>
+static bool _AppendFormatted(std::wstring& dst, const wchar_t* spec, T arg) {
+	wchar_t buf[256];
+	int size = _snwprintf(buf, 256U, spec, arg);
+	if (size >= 0 && size < 256) {
+		dst.append(buf, size);
+		return true;
+	}
+
+	//Truncated or failed, _snwprintf reports both as -1
+	size = _snwprintf(nullptr, 0U, spec, arg);
+	if (size < 0) return false;
+	size_t pos = dst.size();
+	dst.resize(pos + size + 1);
+	_snwprintf(&dst[pos], size + 1, spec, arg);
+	dst.resize(pos + size);
+	return true;
+}
+bool ScriptFormatCache::Format(std::wstring& dst, const std::wstring& format, const std::wstring& types, const value* argv) {
+	const Template& data = Get(format);
+	if (!data.bSupported) return false;
+
+	//Every spec must read exactly the type its argument was pushed as
+	{
+		size_t iArg = 0;
+		for (const Segment& seg : data.listSegment) {
+			if (seg.type == SegmentType::Literal) continue;
+			if (iArg >= types.size()) return false;
+
+			char ch = (char)types[iArg++];
+			bool bMatch = false;
+			switch (seg.type) {
+			case SegmentType::Int:		bMatch = ch == 'd'; break;
+			case SegmentType::Int64:	bMatch = ch == 'l'; break;
+			case SegmentType::Float:	bMatch = ch == 'f'; break;
+			case SegmentType::String:	bMatch = ch == 's'; break;
+			}
+			if (!bMatch) return false;
+		}
+	}
+
+	dst.clear();
+
+	const value* pValue = argv;
+	for (const Segment& seg : data.listSegment) {
+		const wchar_t* spec = data.text.data() + seg.pos;
+
+		bool bValid = true;
+		switch (seg.type) {
+		case SegmentType::Literal:
+			dst.append(spec, seg.length);
+			break;
+		case SegmentType::Int:
+		{
+			int num = (int)((pValue++)->as_int());
+			if (seg.bPlain) StringUtility::AppendInteger(dst, num);
+			else bValid = _AppendFormatted(dst, spec, num);
+			break;
+		}
+		case SegmentType::Int64:
+		{
+			int64_t num = (pValue++)->as_int();
+			if (seg.bPlain) StringUtility::AppendInteger(dst, num);
+			else bValid = _AppendFormatted(dst, spec, num);
+			break;
+		}
+		case SegmentType::Float:
+			bValid = _AppendFormatted(dst, spec, (pValue++)->as_float());
+			break;
+		case SegmentType::String:
+			if (seg.bPlain) {
+				//%s stops at the first null character
+				size_t pos = dst.size();
+				(pValue++)->append_string(dst);
+				size_t posNull = dst.find(L'\0', pos);
+				if (posNull != std::wstring::npos)
+					dst.resize(posNull);
+			}
+			else {
+				std::wstring str = (pValue++)->as_string();
+				bValid = _AppendFormatted(dst, spec, str.c_str());
+			}
+			break;
+		}
+
+		//A failed conversion fails the whole string in _vsnwprintf
+		if (!bValid) {
+			dst.clear();
+			break;
+		}
+	}
+	return true;
+}
+
 //****************************************************************************
 //ScriptClientBase
 //****************************************************************************
@@ -1058,6 +1341,28 @@ value ScriptClientBase::Func_RandEffI(script_machine* machine, int argc, const v
 	return script->CreateIntValue(script->mtEffect_->GetReal(min, max));
 }
 
+template<bool TO_INT>
+static value _CreateRandArray(RandProvider* rand, size_t size, double min, double max) {
+	type_data* typeElem = TO_INT ? script_type_manager::get_int_type() : script_type_manager::get_float_type();
+	type_data* typeArr = TO_INT ? script_type_manager::get_int_array_type() : script_type_manager::get_float_array_type();
+
+	ref_unsync_ptr<std::vector<value>> arr = new std::vector<value>(size);
+
+	//Generate in chunks straight from the provider, then write the array elements in place
+	double chunk[128];
+	for (size_t i = 0; i < size;) {
+		size_t count = std::min<size_t>(size - i, 128U);
+		rand->Fill(chunk, count, min, max);
+		for (size_t j = 0; j < count; ++j, ++i) {
+			if (TO_INT) (*arr)[i].set(typeElem, (int64_t)chunk[j]);
+			else (*arr)[i].set(typeElem, chunk[j]);
+		}
+	}
+
+	value res;
+	res.set(typeArr, arr);
+	return res;
+}
 value ScriptClientBase::Func_RandArray(script_machine* machine, int argc, const value* argv) {
 	ScriptClientBase* script = reinterpret_cast<ScriptClientBase*>(machine->data);
 	script->CheckRunInMainThread();
@@ -1065,18 +1370,9 @@ value ScriptClientBase::Func_RandArray(script_machine* machine, int argc, const
 	size_t size = argv[0].as_int();
 	double min = argv[1].as_float();
 	double max = argv[2].as_float();
-	value res;
-	std::vector<value> resArr;
 
-	type_data* type = script_type_manager::get_float_type();
-
-	for (int i = 0; i < size; ++i) {
-		++randCalls_;
-		resArr.push_back(value(type, script->mt_->GetReal(min, max)));
-	}
-
-	res.reset(script_type_manager::get_float_array_type(), resArr);
-	return res;
+	randCalls_ += size;
+	return _CreateRandArray<false>(script->mt_.get(), size, min, max);
 }
 value ScriptClientBase::Func_RandEffArray(script_machine* machine, int argc, const value* argv) {
 	ScriptClientBase* script = reinterpret_cast<ScriptClientBase*>(machine->data);
@@ -1085,18 +1381,9 @@ value ScriptClientBase::Func_RandEffArray(script_machine* machine, int argc, con
 	size_t size = argv[0].as_int();
 	double min = argv[1].as_float();
 	double max = argv[2].as_float();
-	value res;
-	std::vector<value> resArr;
-
-	type_data* type = script_type_manager::get_float_type();
 
-	for (int i = 0; i < size; ++i) {
-		++prandCalls_;
-		resArr.push_back(value(type, script->mtEffect_->GetReal(min, max)));
-	}
-
-	res.reset(script_type_manager::get_float_array_type(), resArr);
-	return res;
+	prandCalls_ += size;
+	return _CreateRandArray<false>(script->mtEffect_.get(), size, min, max);
 }
 
 value ScriptClientBase::Func_RandArrayI(script_machine* machine, int argc, const value* argv) {
@@ -1106,18 +1393,9 @@ value ScriptClientBase::Func_RandArrayI(script_machine* machine, int argc, const
 	size_t size = argv[0].as_int();
 	double min = argv[1].as_int();
 	double max = argv[2].as_int() + 0.9999999;
-	value res;
-	std::vector<value> resArr;
-
-	type_data* type = script_type_manager::get_int_type();
-
-	for (int i = 0; i < size; ++i) {
-		++randCalls_;
-		resArr.push_back(value(type, (int64_t)script->mt_->GetReal(min, max))); // Why is this necessary :dying:
-	}
 
-	res.reset(script_type_manager::get_int_array_type(), resArr);
-	return res;
+	randCalls_ += size;
+	return _CreateRandArray<true>(script->mt_.get(), size, min, max);
 }
 value ScriptClientBase::Func_RandEffArrayI(script_machine* machine, int argc, const value* argv) {
 	ScriptClientBase* script = reinterpret_cast<ScriptClientBase*>(machine->data);
@@ -1126,18 +1404,9 @@ value ScriptClientBase::Func_RandEffArrayI(script_machine* machine, int argc, co
 	size_t size = argv[0].as_int();
 	double min = argv[1].as_int();
 	double max = argv[2].as_int() + 0.9999999;
-	value res;
-	std::vector<value> resArr;
-
-	type_data* type = script_type_manager::get_int_type();
 
-	for (int i = 0; i < size; ++i) {
-		++prandCalls_;
-		resArr.push_back(value(type, (int64_t)script->mtEffect_->GetReal(min, max)));
-	}
-
-	res.reset(script_type_manager::get_int_array_type(), resArr);
-	return res;
+	prandCalls_ += size;
+	return _CreateRandArray<true>(script->mtEffect_.get(), size, min, max);
 }
 
 value ScriptClientBase::Func_Choose(script_machine* machine, int argc, const value* argv) {
@@ -1546,15 +1815,22 @@ value ScriptClientBase::Func_Rotate3D(script_machine* machine, int argc, const v
 
 //組み込み関数：文字列操作
 value ScriptClientBase::Func_ToString(script_machine* machine, int argc, const value* argv) {
-	return CreateStringValue(argv->as_string());
+	ScriptClientBase* script = reinterpret_cast<ScriptClientBase*>(machine->data);
+	std::wstring& res = script->cacheFormat_.GetBuffer();
+	argv->append_string(res);
+	return CreateStringValue(res.data(), res.size());
 }
 value ScriptClientBase::Func_ItoA(script_machine* machine, int argc, const value* argv) {
-	std::wstring res = std::to_wstring(argv->as_int());
-	return CreateStringValue(res);
+	ScriptClientBase* script = reinterpret_cast<ScriptClientBase*>(machine->data);
+	std::wstring& res = script->cacheFormat_.GetBuffer();
+	StringUtility::AppendInteger(res, argv->as_int());
+	return CreateStringValue(res.data(), res.size());
 }
 value ScriptClientBase::Func_RtoA(script_machine* machine, int argc, const value* argv) {
-	std::wstring res = std::to_wstring(argv->as_float());
-	return CreateStringValue(res);
+	ScriptClientBase* script = reinterpret_cast<ScriptClientBase*>(machine->data);
+	std::wstring& res = script->cacheFormat_.GetBuffer();
+	StringUtility::AppendFloat(res, argv->as_float());
+	return CreateStringValue(res.data(), res.size());
 }
 value ScriptClientBase::Func_RtoS(script_machine* machine, int argc, const value* argv) {
 	std::string res = "";
@@ -1653,6 +1929,7 @@ value ScriptClientBase::Func_VtoS(script_machine* machine, int argc, const value
 	return CreateStringValue(StringUtility::ConvertMultiToWide(res));
 }
 value ScriptClientBase::Func_StringFormat(script_machine* machine, int argc, const value* argv) {
+	ScriptClientBase* script = reinterpret_cast<ScriptClientBase*>(machine->data);
 	std::wstring res = L"";
 	
 	std::wstring srcStr = argv[0].as_string();
@@ -1661,6 +1938,18 @@ value ScriptClientBase::Func_StringFormat(script_machine* machine, int argc, con
 	try {
 		if (fmtTypes.size() != argc - 2)
 			throw L"[invalid argc]";
+		for (char ch : fmtTypes) {
+			if (ch != 'd' && ch != 'l' && ch != 'f' && ch != 's')
+				throw L"[invalid format]";
+		}
+
+		{
+			std::wstring& buffer = script->cacheFormat_.GetBuffer();
+			if (script->cacheFormat_.Format(buffer, srcStr, fmtTypes, &argv[2]))
+				return CreateStringValue(buffer.data(), buffer.size());
+		}
+
+		//Fallback for templates the cache can't handle
 
 		std::list<std::wstring> stringCache;
 		std::vector<byte> fakeVaList;
@@ -1775,7 +2064,7 @@ value ScriptClientBase::Func_RegexMatch(script_machine* machine, int argc, const
 	std::vector<std::wstring> res;
 
 	std::wsmatch base_match;
-	if (std::regex_search(str, base_match, std::wregex(pattern))) {
+	if (std::regex_search(str, base_match, script->cacheRegex_.Get(pattern))) {
 		for (const std::wssub_match& itr : base_match) {
 			res.push_back(itr.str());
 		}
@@ -1791,7 +2080,7 @@ value ScriptClientBase::Func_RegexMatchRepeated(script_machine* machine, int arg
 	std::vector<gstd::value> valueArrayRes;
 	std::vector<std::wstring> singleArray;
 
-	std::wregex reg(pattern);
+	const std::wregex& reg = script->cacheRegex_.Get(pattern);
 	auto itrBegin = std::wsregex_iterator(str.begin(), str.end(), reg);
 	auto itrEnd = std::wsregex_iterator();
 
@@ -1812,7 +2101,7 @@ value ScriptClientBase::Func_RegexReplace(script_machine* machine, int argc, con
 	std::wstring str = argv[0].as_string();
 	std::wstring pattern = argv[1].as_string();
 	std::wstring replacing = argv[2].as_string();
-	return script->CreateStringValue(std::regex_replace(str, std::wregex(pattern), replacing));
+	return script->CreateStringValue(std::regex_replace(str, script->cacheRegex_.Get(pattern), replacing));
 }
 value ScriptClientBase::Func_DigitToArray(script_machine* machine, int argc, const value* argv) {
 	// mkm why didn't you just hardcode this
@@ -2435,11 +2724,11 @@ value ScriptClientBase::Func_LoadCommonDataValuePointer(script_machine* machine,
 
 		auto resFind = dataArea->IsExists(key);
 		if (resFind.first) {
-			pData = &(resFind.second->second);
+			pData = dataArea->GetValuePointer(resFind.second);
 		}
 		else if (argc == 2) {
 			dataArea->SetValue(key, argv[1]);
-			pData = &(dataArea->IsExists(key).second->second);
+			pData = dataArea->GetValuePointer(dataArea->IsExists(key).second);
 		}
 		else dataArea = nullptr;
 
@@ -2465,11 +2754,11 @@ value ScriptClientBase::Func_LoadAreaCommonDataValuePointer(script_machine* mach
 		if (pArea) {
 			auto resFind = pArea->IsExists(key);
 			if (resFind.first) {
-				pData = &(resFind.second->second);
+				pData = pArea->GetValuePointer(resFind.second);
 			}
 			else if (argc == 3) {
 				pArea->SetValue(key, argv[2]);
-				pData = &(pArea->IsExists(key).second->second);
+				pData = pArea->GetValuePointer(pArea->IsExists(key).second);
 			}
 			else pArea = nullptr;
 
@@ -3121,8 +3410,16 @@ ScriptCommonDataManager::ScriptCommonDataManager() {
 	inst_ = this;
 
 	defaultAreaIterator_ = CreateArea(nameAreaDefault_);
+
+	threadSave_.reset(new SaveThread());
+	threadSave_->Start();
 }
 ScriptCommonDataManager::~ScriptCommonDataManager() {
+	//Pending saves are flushed before the thread exits
+	threadSave_->Stop();
+	threadSave_->Join();
+	threadSave_ = nullptr;
+
 	for (auto itr = mapData_.begin(); itr != mapData_.end(); ++itr) {
 		itr->second->Clear();
 		//delete itr->second;
@@ -3180,6 +3477,127 @@ void ScriptCommonDataManager::SetData(CommonDataMap::iterator itr, shared_ptr<Sc
 	if (itr == mapData_.end()) return;
 	itr->second = commonData;
 }
+bool ScriptCommonDataManager::SaveArea(shared_ptr<ScriptCommonData> commonData, const std::wstring& path, uint64_t version) {
+	if (commonData == nullptr) return false;
+
+	std::wstring dirSave = PathProperty::GetFileDirectory(path);
+	File::CreateFileDirectory(dirSave);
+
+	//Only modified keys are serialized here, the file itself is written by the save thread.
+	//A failed write is logged there and reported by the next save of the same file.
+	bool res = !threadSave_->ConsumeFailure(path);
+
+	shared_ptr<RecordBuffer> record(new RecordBuffer());
+	commonData->WriteRecord(*record);
+	threadSave_->AddRequest(path, version, record);
+
+	return res;
+}
+bool ScriptCommonDataManager::IsSaveFailed(const std::wstring& path) {
+	return threadSave_->ConsumeFailure(path);
+}
+bool ScriptCommonDataManager::LoadArea(const std::string& name, const std::wstring& path, uint64_t version) {
+	//Make sure a save of the same file isn't still in flight
+	WaitForSaveComplete();
+
+	RecordBuffer record;
+	if (!record.ReadFromFile(path, version,
+		ScriptCommonData::HEADER_SAVED_DATA, ScriptCommonData::HEADER_SAVED_DATA_SIZE))
+		return false;
+
+	shared_ptr<ScriptCommonData> commonData(new ScriptCommonData());
+	commonData->ReadRecord(record);
+	SetData(name, commonData);
+
+	return true;
+}
+void ScriptCommonDataManager::WaitForSaveComplete() {
+	threadSave_->WaitForComplete();
+}
+
+//ScriptCommonDataManager::SaveThread
+ScriptCommonDataManager::SaveThread::SaveThread() : signalComplete_(true) {
+	countWriting_ = 0;
+	signalComplete_.SetSignal(true);
+}
+ScriptCommonDataManager::SaveThread::~SaveThread() {}
+void ScriptCommonDataManager::SaveThread::_Run() {
+	while (this->GetStatus() == RUN) {
+		signal_.Wait(100);
+		_Flush();
+	}
+	_Flush();
+}
+void ScriptCommonDataManager::SaveThread::_Flush() {
+	while (true) {
+		SaveRequest request;
+		{
+			Lock lock(lock_);
+			if (listRequest_.size() == 0) break;
+			request = listRequest_.front();
+			listRequest_.pop_front();
+			++countWriting_;
+		}
+
+		bool res = false;
+		try {
+			res = request.record->WriteToFile(request.path, request.version,
+				ScriptCommonData::HEADER_SAVED_DATA, ScriptCommonData::HEADER_SAVED_DATA_SIZE);
+		}
+		catch (...) {}
+		if (!res) {
+			Logger::WriteTop(StringUtility::Format(L"ScriptCommonDataManager: Failed to save common data to \"%s\".",
+				request.path.c_str()));
+		}
+
+		{
+			Lock lock(lock_);
+			--countWriting_;
+			if (res)
+				setFailedPath_.erase(request.path);
+			else
+				setFailedPath_.insert(request.path);
+
+			if (listRequest_.size() == 0 && countWriting_ == 0)
+				signalComplete_.SetSignal(true);
+		}
+	}
+}
+void ScriptCommonDataManager::SaveThread::Stop() {
+	Thread::Stop();
+	signal_.SetSignal();
+}
+void ScriptCommonDataManager::SaveThread::AddRequest(const std::wstring& path, uint64_t version, shared_ptr<RecordBuffer> record) {
+	{
+		Lock lock(lock_);
+
+		//A queued save of the same file is simply superseded
+		bool bReplaced = false;
+		for (SaveRequest& iRequest : listRequest_) {
+			if (iRequest.path != path) continue;
+			iRequest.version = version;
+			iRequest.record = record;
+			bReplaced = true;
+			break;
+		}
+		if (!bReplaced)
+			listRequest_.push_back({ path, version, record });
+
+		signalComplete_.SetSignal(false);
+		signal_.SetSignal();
+	}
+}
+bool ScriptCommonDataManager::SaveThread::IsComplete() {
+	Lock lock(lock_);
+	return listRequest_.size() == 0 && countWriting_ == 0;
+}
+void ScriptCommonDataManager::SaveThread::WaitForComplete() {
+	signalComplete_.Wait();
+}
+bool ScriptCommonDataManager::SaveThread::ConsumeFailure(const std::wstring& path) {
+	Lock lock(lock_);
+	return setFailedPath_.erase(path) > 0;
+}
 //****************************************************************************
 //ScriptCommonData
 //****************************************************************************
@@ -3189,10 +3607,36 @@ ScriptCommonData::ScriptCommonData() {
 ScriptCommonData::~ScriptCommonData() {}
 void ScriptCommonData::Clear() {
 	mapValue_.clear();
+	mapRecordCache_.clear();
+	setUndecoded_.clear();
+	setPointerKey_.clear();
+}
+void ScriptCommonData::_DecodeValue(std::map<std::string, gstd::value>::iterator itr) {
+	if (setUndecoded_.size() == 0) return;
+
+	auto itrUndecoded = setUndecoded_.find(itr->first);
+	if (itrUndecoded == setUndecoded_.end()) return;
+	setUndecoded_.erase(itrUndecoded);
+
+	auto itrRecord = mapRecordCache_.find(itr->first);
+	if (itrRecord == mapRecordCache_.end()) return;
+
+	gstd::ByteBuffer& buffer = itrRecord->second->GetBufferRef();
+	buffer.Seek(0);
+
+	uint32_t storedSize = buffer.ReadValue<uint32_t>();
+	if (storedSize > 0U)
+		itr->second = _ReadRecord(buffer);
+}
+void ScriptCommonData::_InvalidateRecord(const std::string& name) {
+	mapRecordCache_.erase(name);
+	setUndecoded_.erase(name);
 }
 std::pair<bool, std::map<std::string, gstd::value>::iterator> ScriptCommonData::IsExists(const std::string& name) {
 	auto itr = mapValue_.find(name);
-	return std::make_pair(itr != mapValue_.end(), itr);
+	bool bExists = itr != mapValue_.end();
+	if (bExists) _DecodeValue(itr);
+	return std::make_pair(bExists, itr);
 }
 gstd::value* ScriptCommonData::GetValueRef(const std::string& name) {
 	auto itr = mapValue_.find(name);
@@ -3200,6 +3644,15 @@ gstd::value* ScriptCommonData::GetValueRef(const std::string& name) {
 }
 gstd::value* ScriptCommonData::GetValueRef(std::map<std::string, gstd::value>::iterator itr) {
 	if (itr == mapValue_.end()) return nullptr;
+	_DecodeValue(itr);
+	return &itr->second;
+}
+gstd::value* ScriptCommonData::GetValuePointer(std::map<std::string, gstd::value>::iterator itr) {
+	if (itr == mapValue_.end()) return nullptr;
+	_DecodeValue(itr);
+	//The value may be modified at any time through the pointer, so it can't have a cached record
+	setPointerKey_.insert(itr->first);
+	mapRecordCache_.erase(itr->first);
 	return &itr->second;
 }
 gstd::value ScriptCommonData::GetValue(const std::string& name) {
@@ -3208,45 +3661,43 @@ gstd::value ScriptCommonData::GetValue(const std::string& name) {
 }
 gstd::value ScriptCommonData::GetValue(std::map<std::string, gstd::value>::iterator itr) {
 	if (itr == mapValue_.end()) return value();
+	_DecodeValue(itr);
 	return itr->second;
 }
 void ScriptCommonData::SetValue(const std::string& name, gstd::value v) {
+	_InvalidateRecord(name);
 	mapValue_[name] = v;
 }
 void ScriptCommonData::SetValue(std::map<std::string, gstd::value>::iterator itr, gstd::value v) {
 	if (itr == mapValue_.end()) return;
+	_InvalidateRecord(itr->first);
 	itr->second = v;
 }
 void ScriptCommonData::DeleteValue(const std::string& name) {
+	_InvalidateRecord(name);
+	setPointerKey_.erase(name);
 	mapValue_.erase(name);
 }
 void ScriptCommonData::Copy(shared_ptr<ScriptCommonData>& dataSrc) {
-	mapValue_.clear();
-	for (auto itrKey = dataSrc->MapBegin(); itrKey != dataSrc->MapEnd(); ++itrKey) {
-		mapValue_.insert(std::make_pair(itrKey->first, itrKey->second));
-	}
+	//Cached records are immutable once created, so they can be shared between areas
+	mapValue_ = dataSrc->mapValue_;
+	mapRecordCache_ = dataSrc->mapRecordCache_;
+	setUndecoded_ = dataSrc->setUndecoded_;
+	setPointerKey_.clear();
 }
 void ScriptCommonData::ReadRecord(gstd::RecordBuffer& record) {
-	mapValue_.clear();
+	Clear();
 
+	//Values are only decoded when first accessed
 	std::vector<std::string> listKey = record.GetKeyList();
 	for (const std::string& key : listKey) {
 		shared_ptr<RecordEntry> entry = record.GetEntry(key);
-		gstd::ByteBuffer& buffer = entry->GetBufferRef();
-
-		gstd::value storedVal;
-		uint32_t storedSize = 0U;
-		buffer.Seek(0);
-		buffer.Read(&storedSize, sizeof(uint32_t));
-
-		if (storedSize > 0U) {
-			gstd::ByteBuffer bufferRes;
-			bufferRes.SetSize(storedSize);
-			buffer.Read(bufferRes.GetPointer(), bufferRes.GetSize());
-			storedVal = _ReadRecord(bufferRes);
-		}
+		mapValue_[key] = value();
+		//Too short to hold a value, kept as an empty one
+		if (entry->GetBufferRef().GetSize() < sizeof(uint32_t)) continue;
 
-		mapValue_[key] = storedVal;
+		mapRecordCache_[key] = entry;
+		setUndecoded_.insert(key);
 	}
 }
 gstd::value ScriptCommonData::_ReadRecord(gstd::ByteBuffer& buffer) {
@@ -3298,9 +3749,20 @@ gstd::value ScriptCommonData::_ReadRecord(gstd::ByteBuffer& buffer) {
 void ScriptCommonData::WriteRecord(gstd::RecordBuffer& record) {
 	for (auto itrValue = mapValue_.begin(); itrValue != mapValue_.end(); ++itrValue) {
 		const std::string& key = itrValue->first;
+
+		//Unchanged keys reuse their previous serialization
+		auto itrCache = mapRecordCache_.find(key);
+		if (itrCache != mapRecordCache_.end()) {
+			record.SetRecordEntry(itrCache->second);
+			continue;
+		}
+
 		const gstd::value& comVal = itrValue->second;
-		
-		gstd::ByteBuffer buffer;
+
+		shared_ptr<RecordEntry> entry(new RecordEntry());
+		entry->SetKey(key);
+
+		gstd::ByteBuffer& buffer = entry->GetBufferRef();
 		buffer.WriteValue<uint32_t>(0U);
 
 		if (comVal.has_data()) {
@@ -3309,7 +3771,9 @@ void ScriptCommonData::WriteRecord(gstd::RecordBuffer& record) {
 			buffer.WriteValue<uint32_t>(buffer.GetSize() - sizeof(uint32_t));
 		}
 
-		record.SetRecord(key, buffer.GetPointer(), buffer.GetSize());
+		record.SetRecordEntry(entry);
+		if (setPointerKey_.find(key) == setPointerKey_.end())
+			mapRecordCache_[key] = entry;
 	}
 }
 void ScriptCommonData::_WriteRecord(gstd::ByteBuffer& buffer, const gstd::value& comValue) {
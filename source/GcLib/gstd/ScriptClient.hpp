@@ -87,6 +87,83 @@ namespace gstd {
 		bool IsExists(const std::wstring& name);
 	};
 
+	//*******************************************************************
+	//ScriptRegexCache
+	//*******************************************************************
+	//Bounded LRU cache of compiled regexes, keyed by pattern and syntax flags
+	class ScriptRegexCache {
+	public:
+		using Flags = std::regex_constants::syntax_option_type;
+		using Key = std::pair<std::wstring, Flags>;
+
+		enum : size_t {
+			DEFAULT_CAPACITY = 64U,
+		};
+	protected:
+		size_t capacity_;
+
+		std::list<std::pair<Key, std::wregex>> listEntry_;		//Most recently used at the front
+		std::map<Key, std::list<std::pair<Key, std::wregex>>::iterator> mapEntry_;
+	public:
+		ScriptRegexCache();
+
+		void Clear();
+		void SetCapacity(size_t capacity);
+
+		//Throws std::regex_error on an invalid pattern, nothing is cached in that case
+		const std::wregex& Get(const std::wstring& pattern, Flags flags = std::regex_constants::ECMAScript);
+	};
+
+	//*******************************************************************
+	//ScriptFormatCache
+	//*******************************************************************
+	//Parse-once cache of StringFormat templates, also owns the reused output buffer
+	class ScriptFormatCache {
+	public:
+		enum : size_t {
+			DEFAULT_CAPACITY = 64U,
+		};
+		enum class SegmentType : uint8_t {
+			Literal,
+			Int,		//Reads an int
+			Int64,		//Reads an int64_t
+			Float,		//Reads a double
+			String,		//Reads a wchar_t*
+		};
+		struct Segment {
+			SegmentType type;
+			bool bPlain;		//Bare "%d", "%lld" or "%s", written without going through the CRT
+			size_t pos;			//Offset into Template::text, specs are null-terminated
+			size_t length;
+		};
+		struct Template {
+			bool bSupported;	//false if the string uses anything not parsed here, e.g. '*' widths
+			std::wstring text;
+			std::vector<Segment> listSegment;
+		};
+	protected:
+		size_t capacity_;
+		std::unordered_map<std::wstring, Template> mapTemplate_;
+
+		std::wstring buffer_;
+
+		static void _Parse(Template& res, const std::wstring& format);
+	public:
+		ScriptFormatCache();
+
+		void Clear();
+		void SetCapacity(size_t capacity);
+
+		const Template& Get(const std::wstring& format);
+
+		//Returns the shared output buffer, emptied
+		std::wstring& GetBuffer() { buffer_.clear(); return buffer_; }
+
+		//Formats into dst with the same output as _vsnwprintf, types as in StringFormat.
+		//Returns false if the template or argument types aren't supported, dst is then left untouched.
+		bool Format(std::wstring& dst, const std::wstring& format, const std::wstring& types, const value* argv);
+	};
+
 	//*******************************************************************
 	//ScriptClientBase
 	//*******************************************************************
@@ -122,6 +199,9 @@ namespace gstd {
 
 		std::vector<gstd::value> listValueArg_;
 		gstd::value valueRes_;
+
+		ScriptRegexCache cacheRegex_;
+		ScriptFormatCache cacheFormat_;
 	protected:
 		void _AddFunction(const char* name, dnh_func_callback_t f, size_t arguments);
 		void _AddFunction(const std::vector<gstd::function>* f);
@@ -180,6 +260,7 @@ namespace gstd {
 		static inline value CreateBooleanValue(bool b);
 		static inline value CreateCharValue(wchar_t c);
 		static inline value CreateStringValue(const std::wstring& s);
+		static inline value CreateStringValue(const wchar_t* s, size_t length);
 		static inline value CreateStringValue(const std::string& s);
 		template<typename T> static inline value CreateFloatArrayValue(const std::vector<T>& list);
 		template<typename T> static value CreateFloatArrayValue(const T* ptrList, size_t count);
@@ -448,6 +529,9 @@ namespace gstd {
 	value ScriptClientBase::CreateStringValue(const std::wstring& s) {
 		return value(script_type_manager::get_string_type(), s);
 	}
+	value ScriptClientBase::CreateStringValue(const wchar_t* s, size_t length) {
+		return value(script_type_manager::get_string_type(), s, length);
+	}
 	value ScriptClientBase::CreateStringValue(const std::string& s) {
 		return CreateStringValue(StringUtility::ConvertMultiToWide(s));
 	}
@@ -554,6 +638,16 @@ namespace gstd {
 		volatile size_t verifHash_;
 		std::map<std::string, gstd::value> mapValue_;
 
+		//Serialized form of every key that hasn't changed since the last read/write, reused by WriteRecord
+		std::unordered_map<std::string, shared_ptr<gstd::RecordEntry>> mapRecordCache_;
+		//Keys read from a record whose values haven't been decoded yet
+		std::unordered_set<std::string> setUndecoded_;
+		//Keys whose value pointers were given out to scripts, these are always re-serialized
+		std::unordered_set<std::string> setPointerKey_;
+
+		void _DecodeValue(std::map<std::string, gstd::value>::iterator itr);
+		void _InvalidateRecord(const std::string& name);
+
 		gstd::value _ReadRecord(gstd::ByteBuffer& buffer);
 		void _WriteRecord(gstd::ByteBuffer& buffer, const gstd::value& comValue);
 	public:
@@ -565,6 +659,7 @@ namespace gstd {
 
 		gstd::value* GetValueRef(const std::string& name);
 		gstd::value* GetValueRef(std::map<std::string, gstd::value>::iterator itr);
+		gstd::value* GetValuePointer(std::map<std::string, gstd::value>::iterator itr);
 		gstd::value GetValue(const std::string& name);
 		gstd::value GetValue(std::map<std::string, gstd::value>::iterator itr);
 		void SetValue(const std::string& name, gstd::value v);
@@ -588,11 +683,14 @@ namespace gstd {
 	class ScriptCommonDataManager {
 		static ScriptCommonDataManager* inst_;
 	public:
+		class SaveThread;
 		using CommonDataMap = std::map<std::string, shared_ptr<ScriptCommonData>>;
 	protected:
 		gstd::CriticalSection lock_;
 		CommonDataMap mapData_;
 		CommonDataMap::iterator defaultAreaIterator_;
+
+		unique_ptr<SaveThread> threadSave_;
 	public:
 		static const std::string nameAreaDefault_;
 
@@ -619,6 +717,43 @@ namespace gstd {
 		CommonDataMap::iterator MapEnd() { return mapData_.end(); }
 
 		gstd::CriticalSection& GetLock() { return lock_; }
+
+		bool SaveArea(shared_ptr<ScriptCommonData> commonData, const std::wstring& path, uint64_t version);
+		bool LoadArea(const std::string& name, const std::wstring& path, uint64_t version);
+		void WaitForSaveComplete();
+		bool IsSaveFailed(const std::wstring& path);
+	};
+
+	//*******************************************************************
+	//ScriptCommonDataManager::SaveThread
+	//	Writes serialized areas to disk off the script thread
+	//*******************************************************************
+	class ScriptCommonDataManager::SaveThread : public gstd::Thread {
+		struct SaveRequest {
+			std::wstring path;
+			uint64_t version;
+			shared_ptr<gstd::RecordBuffer> record;
+		};
+	protected:
+		gstd::CriticalSection lock_;
+		gstd::ThreadSignal signal_;
+		std::list<SaveRequest> listRequest_;
+		volatile size_t countWriting_;
+		gstd::ThreadSignal signalComplete_;			//Set while nothing is queued or being written
+		std::set<std::wstring> setFailedPath_;		//Files whose last write failed, until reported
+
+		void _Flush();
+		virtual void _Run();
+	public:
+		SaveThread();
+		virtual ~SaveThread();
+
+		virtual void Stop();
+
+		void AddRequest(const std::wstring& path, uint64_t version, shared_ptr<gstd::RecordBuffer> record);
+		bool IsComplete();
+		void WaitForComplete();
+		bool ConsumeFailure(const std::wstring& path);
 	};
 
 	//*******************************************************************
@@ -53,9 +53,11 @@
 #include <commctrl.h>	//For a lot of stuff in Window.cpp
 #include <pdh.h>		//For performance queries in Logger.cpp
 #include <wingdi.h>		//For font generation in DxText.cpp
+#include <timeapi.h>	//For timer resolution in FpsController.cpp
 #pragma comment (lib, "comctl32.lib")
 #pragma comment (lib, "pdh.lib")
 #pragma comment (lib, "gdi32.lib")
+#pragma comment (lib, "winmm.lib")
 
 //-----------------------------------DirectX------------------------------------
 
@@ -117,6 +119,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <any>
 #include <bitset>
 #include <complex>
@@ -56,6 +56,16 @@ DnhConfiguration::DnhConfiguration() {
 
 	bEnableUnfocusedProcessing_ = false;
 
+	bFramePacing_ = true;
+	framePacingSpin_ = 1500;
+
+	bHeadless_ = false;
+	replaySeekTime_ = 0;
+
+	bTextureCache_ = false;
+	sizeTextureCacheMax_ = 256;
+	bMeshCache_ = false;
+
 	LoadConfigFile();
 	_LoadDefinitionFile();
 }
@@ -90,11 +100,54 @@ bool DnhConfiguration::_LoadDefinitionFile() {
 	fastModeSpeed_ = prop.GetInteger(L"skip.rate", 20);
 	fastModeSpeed_ = std::clamp(fastModeSpeed_, 1, 50);
 
+	{
+		std::wstring str = prop.GetString(L"frame.pacing", L"true");
+		bFramePacing_ = str == L"true" ? true : StringUtility::ToInteger(str);
+
+		framePacingSpin_ = prop.GetInteger(L"frame.pacing.spin", 1500);
+		framePacingSpin_ = std::clamp(framePacingSpin_, 0, 20000);
+	}
+
 	{
 		std::wstring str = prop.GetString(L"unfocused.processing", L"false");
 		bEnableUnfocusedProcessing_ = str == L"true" ? true : StringUtility::ToInteger(str);
 	}
 
+	{
+		std::wstring str = prop.GetString(L"headless.mode", L"false");
+		bHeadless_ = str == L"true" ? true : StringUtility::ToInteger(str);
+
+		if (bHeadless_) {
+			auto _GetPath = [&](const std::wstring& key, const std::wstring& def) -> std::wstring {
+				std::wstring path = prop.GetString(key, def);
+				if (path.size() == 0) return path;
+				return PathProperty::ExtendRelativeToFull(PathProperty::GetModuleDirectory(), path);
+			};
+			pathHeadlessScript_ = _GetPath(L"headless.script", L"");
+			pathHeadlessReplay_ = _GetPath(L"headless.replay", L"");
+			pathHeadlessReport_ = _GetPath(L"headless.report", L"headless_report.csv");
+
+			//Nothing to run
+			if (pathHeadlessScript_.size() == 0 || pathHeadlessReplay_.size() == 0)
+				bHeadless_ = false;
+			else
+				bEnableUnfocusedProcessing_ = true;
+		}
+	}
+
+	replaySeekTime_ = std::max(prop.GetInteger(L"replay.seek", 0), 0);
+
+	{
+		std::wstring str = prop.GetString(L"texture.cache", L"false");
+		bTextureCache_ = str == L"true" ? true : StringUtility::ToInteger(str);
+
+		sizeTextureCacheMax_ = prop.GetInteger(L"texture.cache.size", 256);
+		sizeTextureCacheMax_ = std::max(sizeTextureCacheMax_, 1U);
+
+		str = prop.GetString(L"mesh.cache", L"false");
+		bMeshCache_ = str == L"true" ? true : StringUtility::ToInteger(str);
+	}
+
 	{
 		if (prop.HasProperty(L"window.size.list")) {
 			std::wstring strList = prop.GetString(L"window.size.list", L"");
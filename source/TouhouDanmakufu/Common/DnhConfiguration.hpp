@@ -30,6 +30,9 @@ public:
 	int fpsType_;
 	int fastModeSpeed_;
 
+	bool bFramePacing_;
+	int framePacingSpin_;	//Microseconds
+
 	std::vector<POINT> windowSizeList_;
 	uint32_t windowSizeIndex_;
 
@@ -50,6 +53,20 @@ public:
 
 	std::wstring pathPackageScript_;
 
+	//Headless replay runner, see th_dnh.def "headless.*"
+	bool bHeadless_;
+	std::wstring pathHeadlessScript_;
+	std::wstring pathHeadlessReplay_;
+	std::wstring pathHeadlessReport_;
+
+	//Seconds, see th_dnh.def "replay.seek"
+	uint32_t replaySeekTime_;
+
+	//Decoded resource caches, see th_dnh.def "texture.cache" and "mesh.cache"
+	bool bTextureCache_;
+	uint32_t sizeTextureCacheMax_;	//MB
+	bool bMeshCache_;
+
 	bool _LoadDefinitionFile();
 public:
 	DnhConfiguration();
@@ -149,6 +149,7 @@ EFpsController::EFpsController() {
 		throw gstd::wexception("Invalid refresh rate mode.");
 
 	SetFps(config->fpsStandard_);
+	controller_->SetPacing(config->bFramePacing_, stdch::microseconds(config->framePacingSpin_));
 	fastModeKey_ = DIK_LCONTROL;
 }
 #endif
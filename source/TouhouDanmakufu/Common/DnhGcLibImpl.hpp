@@ -75,6 +75,9 @@ public:
 	float GetCurrentWorkFps() { return controller_->GetCurrentWorkFps(); }
 	float GetCurrentRenderFps() { return controller_->GetCurrentRenderFps(); }
 
+	float GetFrameTimeP50() { return controller_->GetFrameTimeP50(); }
+	float GetFrameTimeP99() { return controller_->GetFrameTimeP99(); }
+
 	bool IsFastMode() { return controller_->IsFastMode(); }
 	void SetFastMode(bool b) { controller_->SetFastMode(b); }
 	void SetFastModeRate(size_t rate) { controller_->SetFastModeRate(rate); }
@@ -247,6 +247,12 @@ void ReplayInformation::StageData::ReadRecord(gstd::RecordBuffer& record) {
 	listFramePerSecond_.resize(countFramePerSecond);
 	record.GetRecord("listFramePerSecond", &listFramePerSecond_[0], sizeof(FLOAT) * listFramePerSecond_.size());
 
+	//State hashes, absent from older replays
+	size_t countStateHash = record.GetRecordAs<uint32_t>("countStateHash");
+	listStateHash_.resize(countStateHash);
+	if (countStateHash > 0)
+		record.GetRecord("listStateHash", &listStateHash_[0], sizeof(uint64_t) * countStateHash);
+
 	//Common data
 	gstd::RecordBuffer recComMap;
 	record.GetRecordAsRecordBuffer("mapCommonData", recComMap);
@@ -284,6 +290,12 @@ void ReplayInformation::StageData::WriteRecord(gstd::RecordBuffer& record) {
 	record.SetRecord<uint32_t>("countFramePerSecond", countFramePerSecond);
 	record.SetRecord("listFramePerSecond", &listFramePerSecond_[0], sizeof(FLOAT) * listFramePerSecond_.size());
 
+	//State hashes
+	size_t countStateHash = listStateHash_.size();
+	record.SetRecord<uint32_t>("countStateHash", countStateHash);
+	if (countStateHash > 0)
+		record.SetRecord("listStateHash", &listStateHash_[0], sizeof(uint64_t) * countStateHash);
+
 	//Common data
 	gstd::RecordBuffer recComMap;
 	for (auto itrCommonData = mapCommonData_.begin(); itrCommonData != mapCommonData_.end(); itrCommonData++) {
@@ -69,6 +69,10 @@ public:
 };
 
 class ReplayInformation::StageData {
+public:
+	enum {
+		STATE_HASH_INTERVAL = 60,	//Frames between state hash checkpoints
+	};
 private:
 	std::wstring mainScriptID_;
 	std::wstring mainScriptName_;
@@ -82,6 +86,7 @@ private:
 
 	uint32_t randSeed_;
 	std::vector<float> listFramePerSecond_;
+	std::vector<uint64_t> listStateHash_;
 	ref_count_ptr<gstd::RecordBuffer> recordKey_;
 	std::map<std::string, ref_count_ptr<gstd::RecordBuffer>> mapCommonData_;
 
@@ -118,6 +123,9 @@ public:
 	float GetFramePerSecond(int frame) { int index = frame / 60; int res = index < listFramePerSecond_.size() ? listFramePerSecond_[index] : 0; return res; }
 	void AddFramePerSecond(float frame) { listFramePerSecond_.push_back(frame); }
 	double GetFramePerSecondAverage();
+	size_t GetStateHashCount() { return listStateHash_.size(); }
+	uint64_t GetStateHash(size_t index) { return listStateHash_[index]; }
+	void AddStateHash(uint64_t hash) { listStateHash_.push_back(hash); }
 	ref_count_ptr<gstd::RecordBuffer> GetReplayKeyRecord() { return recordKey_; }
 	void SetReplayKeyRecord(ref_count_ptr<gstd::RecordBuffer> rec) { recordKey_ = rec; }
 	std::set<std::string> GetCommonDataAreaList();
@@ -35,6 +35,16 @@ StgMoveObject::~StgMoveObject() {
 	}
 }
 
+StgMoveObject* StgMoveObject::CastFromObject(DxScriptObjectBase* obj) {
+	if (auto objShot = DxScriptObjectBase::CastTo<StgShotObject>(obj))
+		return objShot;
+	if (auto objEnemy = DxScriptObjectBase::CastTo<StgEnemyObject>(obj))
+		return objEnemy;
+	if (auto objItem = DxScriptObjectBase::CastTo<StgItemObject>(obj))
+		return objItem;
+	return DxScriptObjectBase::CastTo<StgPlayerObject>(obj);
+}
+
 void StgMoveObject::Copy(StgMoveObject* src) {
 	posX_ = src->posX_;
 	posY_ = src->posY_;
@@ -236,6 +246,7 @@ double StgMoveObject::GetAngleFromParent() {
 //****************************************************************************
 StgMoveParent::StgMoveParent(StgStageController* stageController) : StgObjectBase(stageController) {
 	typeObject_ = TypeObject::MoveParent;
+	bCleanUpRequired_ = true;
 
 	target_ = nullptr;
 	typeAngle_ = ANGLE_FIXED;
@@ -24,6 +24,11 @@ class StgMoveParent;
 class StgMoveObject : public StgObjectBase {
 	friend StgMovePattern;
 	friend StgMoveParent;
+public:
+	static constexpr TypeObjectMask TYPE_MASK = {
+		TypeObject::Player, TypeObject::Enemy, TypeObject::EnemyBoss, TypeObject::Shot,
+		TypeObject::LooseLaser, TypeObject::StraightLaser, TypeObject::CurveLaser, TypeObject::Item
+	};
 protected:
 	double posX_;
 	double posY_;
@@ -47,6 +52,8 @@ public:
 	StgMoveObject(StgStageController* stageController);
 	virtual ~StgMoveObject();
 
+	static StgMoveObject* CastFromObject(DxScriptObjectBase* obj);
+
 	virtual void Copy(StgMoveObject* src);
 
 	void Move();
@@ -93,6 +100,8 @@ public:
 class StgMoveParent : public DxScriptObjectBase, public StgObjectBase {
 	friend StgMoveObject;
 public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::MoveParent };
+
 	enum {
 		ANGLE_FIXED,		// Angle is untouched, only changed via move pattern if applicable (arg: specified angle; NO_CHANGE to keep current angle)
 		ANGLE_ROTATE,		// Increment angle only when transform angle is changed (arg: rotated per parent rotation degree; 1 is default)
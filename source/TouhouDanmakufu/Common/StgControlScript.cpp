@@ -60,6 +60,7 @@ static const std::vector<function> stgControlFunction = {
 	{ "AddPoint", StgControlScript::Func_StgStageInformation_void_int64<&StgStageInformation::AddPoint>, 1 },
 
 	{ "IsReplay", StgControlScript::Func_IsReplay, 0 },
+	{ "SeekReplay", StgControlScript::Func_SeekReplay, 1 },
 
 	{ "AddArchiveFile", StgControlScript::Func_AddArchiveFile, 1 },
 	{ "AddArchiveFile", StgControlScript::Func_AddArchiveFile, 2 },		//Overloaded
@@ -208,14 +209,8 @@ gstd::value StgControlScript::Func_SaveCommonDataAreaA1(gstd::script_machine* ma
 	if (commonData) {
 		const std::wstring& pathMain = infoSystem->GetMainScriptInformation()->pathScript_;
 		std::wstring pathSave = EPathProperty::GetCommonDataPath(pathMain, area);
-		std::wstring dirSave = PathProperty::GetFileDirectory(pathSave);
 
-		File::CreateFileDirectory(dirSave);
-
-		RecordBuffer record;
-		commonData->WriteRecord(record);
-		res = record.WriteToFile(pathSave, GAME_VERSION_NUM, 
-			ScriptCommonData::HEADER_SAVED_DATA, ScriptCommonData::HEADER_SAVED_DATA_SIZE);
+		res = commonDataManager->SaveArea(commonData, pathSave, GAME_VERSION_NUM);
 	}
 
 	return script->CreateBooleanValue(res);
@@ -233,14 +228,7 @@ gstd::value StgControlScript::Func_LoadCommonDataAreaA1(gstd::script_machine* ma
 	const std::wstring& pathMain = infoSystem->GetMainScriptInformation()->pathScript_;
 	std::wstring pathSave = EPathProperty::GetCommonDataPath(pathMain, area);
 
-	RecordBuffer record;
-	res = record.ReadFromFile(pathSave, GAME_VERSION_NUM, 
-		ScriptCommonData::HEADER_SAVED_DATA, ScriptCommonData::HEADER_SAVED_DATA_SIZE);
-	if (res) {
-		shared_ptr<ScriptCommonData> commonData(new ScriptCommonData());
-		commonData->ReadRecord(record);
-		commonDataManager->SetData(sArea, commonData);
-	}
+	res = commonDataManager->LoadArea(sArea, pathSave, GAME_VERSION_NUM);
 
 	return script->CreateBooleanValue(res);
 }
@@ -257,14 +245,7 @@ gstd::value StgControlScript::Func_SaveCommonDataAreaA2(gstd::script_machine* ma
 	shared_ptr<ScriptCommonData> commonData = commonDataManager->GetData(area);
 	if (commonData) {
 		std::wstring pathSave = argv[1].as_string();
-		std::wstring dirSave = PathProperty::GetFileDirectory(pathSave);
-
-		File::CreateFileDirectory(dirSave);
-
-		RecordBuffer record;
-		commonData->WriteRecord(record);
-		res = record.WriteToFile(pathSave, GAME_VERSION_NUM, 
-			ScriptCommonData::HEADER_SAVED_DATA, ScriptCommonData::HEADER_SAVED_DATA_SIZE);
+		res = commonDataManager->SaveArea(commonData, pathSave, GAME_VERSION_NUM);
 	}
 
 	return script->CreateBooleanValue(res);
@@ -279,14 +260,7 @@ gstd::value StgControlScript::Func_LoadCommonDataAreaA2(gstd::script_machine* ma
 	bool res = false;
 
 	std::wstring pathSave = argv[1].as_string();
-	RecordBuffer record;
-	res = record.ReadFromFile(pathSave, GAME_VERSION_NUM, 
-		ScriptCommonData::HEADER_SAVED_DATA, ScriptCommonData::HEADER_SAVED_DATA_SIZE);
-	if (res) {
-		shared_ptr<ScriptCommonData> commonData(new ScriptCommonData());
-		commonData->ReadRecord(record);
-		commonDataManager->SetData(area, commonData);
-	}
+	res = commonDataManager->LoadArea(area, pathSave, GAME_VERSION_NUM);
 
 	return script->CreateBooleanValue(res);
 }
@@ -365,6 +339,17 @@ gstd::value StgControlScript::Func_IsReplay(gstd::script_machine* machine, int a
 
 	return script->CreateBooleanValue(res);
 }
+gstd::value StgControlScript::Func_SeekReplay(gstd::script_machine* machine, int argc, const gstd::value* argv) {
+	StgControlScript* script = (StgControlScript*)machine->data;
+
+	bool res = false;
+
+	shared_ptr<StgStageController> stageController = script->systemController_->GetStageController();
+	if (stageController)
+		res = stageController->SetSeekFrame((DWORD)std::max<int64_t>(argv[0].as_int(), 0));
+
+	return script->CreateBooleanValue(res);
+}
 gstd::value StgControlScript::Func_AddArchiveFile(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	FileManager* fileManager = FileManager::GetBase();
 	std::wstring path = argv[0].as_string();
@@ -729,7 +714,7 @@ gstd::value StgControlScript::Func_RenderToTextureB(gstd::script_machine* machin
 	int id = argv[1].as_int();
 	bool bClear = argv[2].as_boolean();
 
-	DxScriptRenderObject* obj = dynamic_cast<DxScriptRenderObject*>(script->GetObjectPointer(id));
+	DxScriptRenderObject* obj = script->GetObjectPointerAs<DxScriptRenderObject>(id);
 	if (obj) {
 		shared_ptr<Texture> texture = _RenderToTexture_LoadTexture(script->pResouceCache_, name);
 
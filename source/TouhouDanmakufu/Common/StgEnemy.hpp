@@ -54,6 +54,8 @@ public:
 //StgEnemyObject
 //*******************************************************************
 class StgEnemyObject : public DxScriptSpriteObject2D, public StgMoveObject, public StgIntersectionObject {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Enemy, TypeObject::EnemyBoss };
 protected:
 	double life_;
 	double lifePrev_;
@@ -132,6 +134,8 @@ public:
 //StgEnemyBossObject
 //*******************************************************************
 class StgEnemyBossObject : public StgEnemyObject {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::EnemyBoss };
 private:
 	int timeSpellCard_;
 public:
@@ -144,6 +148,8 @@ public:
 //StgEnemyBossSceneObject
 //*******************************************************************
 class StgEnemyBossSceneObject : public DxScriptObjectBase, public StgObjectBase {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::EnemyBossScene };
 private:
 	bool bScriptsLoaded_;
 	bool bEnableUnloadCache_;
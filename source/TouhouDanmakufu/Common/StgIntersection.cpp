@@ -4,6 +4,7 @@
 #include "StgShot.hpp"
 #include "StgPlayer.hpp"
 #include "StgEnemy.hpp"
+#include "StgItem.hpp"
 #include "StgSystem.hpp"
 
 //*******************************************************************
@@ -550,6 +551,17 @@ StgIntersectionObject::StgIntersectionObject() {
 	bIntersected_ = false;
 	intersectedCount_ = 0;
 }
+StgIntersectionObject* StgIntersectionObject::CastFromObject(DxScriptObjectBase* obj) {
+	if (auto objShot = DxScriptObjectBase::CastTo<StgShotObject>(obj))
+		return objShot;
+	if (auto objEnemy = DxScriptObjectBase::CastTo<StgEnemyObject>(obj))
+		return objEnemy;
+	if (auto objItem = DxScriptObjectBase::CastTo<StgItemObject>(obj))
+		return objItem;
+	if (auto objSpell = DxScriptObjectBase::CastTo<StgPlayerSpellObject>(obj))
+		return objSpell;
+	return DxScriptObjectBase::CastTo<StgPlayerObject>(obj);
+}
 void StgIntersectionObject::Copy(StgIntersectionObject* src) {
 	bIntersected_ = src->bIntersected_;
 	intersectedCount_ = src->intersectedCount_;
@@ -194,6 +194,12 @@ public:
 
 class StgIntersectionObject {
 public:
+	static constexpr TypeObjectMask TYPE_MASK = {
+		TypeObject::Player, TypeObject::Enemy, TypeObject::EnemyBoss, TypeObject::Shot,
+		TypeObject::LooseLaser, TypeObject::StraightLaser, TypeObject::CurveLaser, TypeObject::Item,
+		TypeObject::Spell
+	};
+
 	using IntersectionPairType = std::pair<bool, ref_unsync_ptr<StgIntersectionTarget>>;
 	using IntersectionListType = std::vector<IntersectionPairType>;
 	static IntersectionPairType CreateEmptyIntersection() {
@@ -215,6 +221,8 @@ public:
 	StgIntersectionObject();
 	virtual ~StgIntersectionObject() {}
 
+	static StgIntersectionObject* CastFromObject(DxScriptObjectBase* obj);
+
 	void Copy(StgIntersectionObject* src);
 
 	virtual void Intersect(StgIntersectionTarget* ownTarget, StgIntersectionTarget* otherTarget) = 0;
@@ -67,6 +67,7 @@ public:
 		listObj_.push_back(obj); 
 	}
 	size_t GetItemCount() { return listObj_.size(); }
+	std::list<ref_unsync_ptr<StgItemObject>>& GetItemList() { return listObj_; }
 
 	ID3DXEffect* GetEffect() { return effectItem_; }
 	D3DXMATRIX* GetProjectionMatrix() { return &matProj_; }
@@ -182,6 +183,8 @@ public:
 class StgItemObject : public DxScriptShaderObject, public StgMoveObject, public StgIntersectionObject {
 	friend class StgItemManager;
 public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Item };
+
 	enum {
 		//Default item IDs
 		ITEM_1UP = -256 * 256,
@@ -37,6 +37,10 @@ StgPlayerObject::StgPlayerObject(StgStageController* stageController) : StgMoveO
 	bForbidSpell_ = false;
 	yAutoItemCollect_ = -256 * 256;
 
+	listGrazedShot_.reserve(256);
+	listGrazedShotID_.reserve(256);
+	listGrazedShotPos_.reserve(256);
+
 	enableGrazeInvincible_ = true;
 	enableStateEnd_ = true;
 	enableShootdownEvent_ = true;
@@ -261,34 +265,28 @@ void StgPlayerObject::KillSelf(int hitObj) {
 void StgPlayerObject::SendGrazeEvent() {
 	if (listGrazedShot_.size() == 0U) return;
 
-	std::vector<value> listValPos;
-	std::vector<int> listShotID;
-
 	stageController_->GetStageInformation()->AddGraze(listGrazedShot_.size());
 
-	size_t iValidGraze = 0;
-	for (auto iObj = listGrazedShot_.begin(); iObj != listGrazedShot_.end(); ++iObj) {
-		if (auto& wObj = *iObj) {
-			//No need to check for a nullptr, listGrazedShot_ only contains StgShotObject* anyway
-			StgShotObject* objShot = dynamic_cast<StgShotObject*>(wObj.get());
-			if (!objShot->IsDeleted()) {
-				double listShotPos[2] = { objShot->GetPositionX(), objShot->GetPositionY() };
-				listValPos.push_back(script_->CreateFloatArrayValue(listShotPos, 2U));
-
-				listShotID.push_back(objShot->GetObjectID());
+	//Scratch buffers keep their capacity across frames
+	listGrazedShotID_.clear();
+	listGrazedShotPos_.clear();
+	for (StgShotObject* objShot : listGrazedShot_) {
+		//The shot may have been deleted by a later intersection in the same pass
+		if (objShot->IsDeleted()) continue;
 
-				++iValidGraze;
-			}
-		}
+		double listShotPos[2] = { objShot->GetPositionX(), objShot->GetPositionY() };
+		listGrazedShotPos_.push_back(script_->CreateFloatArrayValue(listShotPos, 2U));
+		listGrazedShotID_.push_back(objShot->GetObjectID());
 	}
 	listGrazedShot_.clear();
 
+	size_t iValidGraze = listGrazedShotID_.size();
 	if (iValidGraze == 0) return;
 
 	value listScriptValue[3];
 	listScriptValue[0] = script_->CreateIntValue(iValidGraze);
-	listScriptValue[1] = script_->CreateIntArrayValue(listShotID);
-	listScriptValue[2] = script_->CreateValueArrayValue(listValPos);
+	listScriptValue[1] = script_->CreateIntArrayValue(listGrazedShotID_.data(), iValidGraze);
+	listScriptValue[2] = script_->CreateValueArrayValue(listGrazedShotPos_);
 	script_->RequestEvent(StgStagePlayerScript::EV_GRAZE, listScriptValue, 3);
 
 	auto stageScriptManager = stageController_->GetScriptManager();
@@ -316,8 +314,10 @@ void StgPlayerObject::Intersect(StgIntersectionTarget* ownTarget, StgIntersectio
 			}
 		}
 		else if (enableGrazeInvincible_ || frameInvincibility_ <= 0) {
+			//IsValidGraze turns false on the shot's first contact with the player,
+			//	so each shot is added at most once per pass
 			if (objShot != nullptr && objShot->IsValidGraze()) {
-				listGrazedShot_.push_back(wObj);
+				listGrazedShot_.push_back(objShot);
 			}
 		}
 		break;
@@ -359,6 +359,8 @@ bool StgPlayerObject::IsWaitLastSpell() {
 //StgPlayerSpellObject
 //*******************************************************************
 StgPlayerSpellObject::StgPlayerSpellObject(StgStageController* stageController) : StgObjectBase(stageController) {
+	typeObject_ = TypeObject::Spell;
+
 	damage_ = 0;
 	bEraseShot_ = true;
 	life_ = 256 * 256 * 256;
@@ -9,6 +9,7 @@ class StgPlayerObject;
 class StgPlayerInformation;
 class StgPlayerSpellManageObject;
 class StgPlayerSpellObject;
+class StgShotObject;
 
 //*******************************************************************
 //StgPlayerObject
@@ -37,6 +38,8 @@ public:
 
 class StgPlayerObject : public DxScriptSpriteObject2D, public StgMoveObject, public StgIntersectionObject {
 public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Player };
+
 	enum {
 		STATE_NORMAL,
 		STATE_HIT,
@@ -61,7 +64,11 @@ protected:
 	int frameRebirthDiff_;	//Deathbomb frame reduction per hit
 	int frameStateDown_;
 
-	std::list<ref_unsync_weak_ptr<StgIntersectionObject>> listGrazedShot_;
+	//Filled during the intersection pass and flushed in SendGrazeEvent in the same frame,
+	//	StgShotManager keeps the shots alive until then
+	std::vector<StgShotObject*> listGrazedShot_;
+	std::vector<int> listGrazedShotID_;
+	std::vector<gstd::value> listGrazedShotPos_;
 	int hitObjectID_;
 
 	double itemCircle_;
@@ -167,7 +174,10 @@ public:
 //*******************************************************************
 class StgPlayerSpellManageObject : public DxScriptObjectBase, public StgObjectBase {
 public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::SpellManage };
+
 	StgPlayerSpellManageObject(StgStageController* stageController) : StgObjectBase(stageController) {
+		typeObject_ = TypeObject::SpellManage;
 		bVisible_ = false;
 	}
 	
@@ -179,6 +189,8 @@ public:
 //StgPlayerSpellObject
 //*******************************************************************
 class StgPlayerSpellObject : public DxScriptPrimitiveObject2D, public StgObjectBase, public StgIntersectionObject {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Spell };
 protected:
 	double damage_;
 	bool bEraseShot_;
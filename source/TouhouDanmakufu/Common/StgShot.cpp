@@ -30,12 +30,16 @@ StgShotManager::StgShotManager(StgStageController* stageController) {
 		listRenderQueuePlayer_.resize(renderPriMax);
 		listRenderQueueEnemy_.resize(renderPriMax);
 		for (size_t i = 0; i < renderPriMax; ++i) {
-			listRenderQueuePlayer_[i].listShot.resize(32);
-			listRenderQueueEnemy_[i].listShot.resize(32);
+			for (size_t iBlend = 0; iBlend < BLEND_COUNT; ++iBlend) {
+				listRenderQueuePlayer_[i].listShot[iBlend].resize(32);
+				listRenderQueueEnemy_[i].listShot[iBlend].resize(32);
+			}
 		}
 	}
 	pLastTexture_ = nullptr;
 
+	batchQuad_.reset(new StgShotQuadBatch());
+
 	SetDeleteEventEnableByType(StgStageItemScript::EV_DELETE_SHOT_IMMEDIATE, true);
 	SetDeleteEventEnableByType(StgStageItemScript::EV_DELETE_SHOT_FADE, true);
 	SetDeleteEventEnableByType(StgStageItemScript::EV_DELETE_SHOT_TO_ITEM, true);
@@ -70,6 +74,13 @@ std::array<BlendMode, StgShotManager::BLEND_COUNT> StgShotManager::blendTypeRend
 	MODE_BLEND_ALPHA,
 	MODE_BLEND_ALPHA_INV,
 };
+int StgShotManager::_GetBlendRenderIndex(BlendMode blend) {
+	for (size_t i = 0; i < BLEND_COUNT; ++i) {
+		if (blendTypeRenderOrder[i] == blend)
+			return i;
+	}
+	return -1;
+}
 void StgShotManager::Render(int targetPriority) {
 	if (targetPriority < 0 || targetPriority >= listRenderQueueEnemy_.size()) return;
 
@@ -109,15 +120,38 @@ void StgShotManager::Render(int targetPriority) {
 		if (renderQueue.count == 0) return;
 
 		for (size_t iBlend = 0; iBlend < blendTypeRenderOrder.size(); ++iBlend) {
+			size_t countBlend = renderQueue.listCount[iBlend];
+			if (countBlend == 0) continue;
+
 			BlendMode blend = blendTypeRenderOrder[iBlend];
 
 			graphics->SetBlendMode(blend);
 			effectShot_->SetTechnique(blend == MODE_BLEND_ALPHA_INV ? "RenderInv" : "Render");
 
-			for (size_t i = 0; i < renderQueue.count; ++i) {
-				StgShotObject* pShot = renderQueue.listShot[i];
+			const std::vector<StgShotObject*>& listShot = renderQueue.listShot[iBlend];
+			for (size_t i = 0; i < countBlend; ++i) {
+				StgShotObject* pShot = listShot[i];
+
+				//Runs of plain normal shots go through one draw call per texture, everything else
+				//	flushes the pending run first to keep the draw order
+				if (pShot->GetObjectType() == TypeObject::Shot) {
+					StgNormalShotObject* pNormalShot = (StgNormalShotObject*)pShot;
+					if (pNormalShot->IsBatchRenderable()) {
+						StgShotQuadParam quad;
+						if (!pNormalShot->GetRenderQuad(blend, &quad)) continue;
+
+						IDirect3DTexture9* pTexture = quad.frame->GetVertexBufferContainer()->GetD3DTexture();
+						if (batchQuad_->GetCount() > 0 && (batchQuad_->GetTexture() != pTexture || batchQuad_->IsFull()))
+							_RenderQuadBatch();
+						batchQuad_->Add(quad);
+						continue;
+					}
+				}
+
+				_RenderQuadBatch();
 				pShot->Render(blend);
 			}
+			_RenderQuadBatch();
 		}
 	};
 
@@ -133,21 +167,82 @@ void StgShotManager::Render(int targetPriority) {
 	if (bEnableFog)
 		graphics->SetFogEnable(true);
 }
+void StgShotManager::_RenderQuadBatch() {
+	size_t countQuad = batchQuad_->GetCount();
+	if (countQuad == 0) return;
+
+	DirectGraphics* graphics = DirectGraphics::GetBase();
+	IDirect3DDevice9* device = graphics->GetDevice();
+
+	if (graphics->IsAllowRenderTargetChange())
+		graphics->SetRenderTarget(nullptr);
+
+	IDirect3DTexture9* pTexture = batchQuad_->GetTexture();
+	if (pTexture != pLastTexture_) {
+		device->SetTexture(0, pTexture);
+		pLastTexture_ = pTexture;
+	}
+
+	FixedVertexBuffer* vertexBuffer = VertexBufferManager::GetBase()->GetVertexBufferTLX();
+	{
+		std::vector<VERTEX_TLX>& bufferVertex = batchQuad_->Generate();
+
+		BufferLockParameter lockParam = BufferLockParameter(D3DLOCK_DISCARD);
+		lockParam.SetSource(bufferVertex, bufferVertex.size(), sizeof(VERTEX_TLX));
+		vertexBuffer->UpdateBuffer(&lockParam);
+	}
+	device->SetStreamSource(0, vertexBuffer->GetBuffer(), 0, sizeof(VERTEX_TLX));
+
+	//Vertices are already in world space and carry the final color
+	{
+		D3DXHANDLE handle = nullptr;
+		if (handle = effectShot_->GetParameterBySemantic(nullptr, "WORLD")) {
+			effectShot_->SetMatrix(handle, &graphics->GetCamera()->GetIdentity());
+		}
+		if (handle = effectShot_->GetParameterBySemantic(nullptr, "ICOLOR")) {
+			D3DXVECTOR4 vColor(1, 1, 1, 1);
+			effectShot_->SetVector(handle, &vColor);
+		}
+
+		UINT countPass = 1;
+		effectShot_->Begin(&countPass, D3DXFX_DONOTSAVESHADERSTATE);
+		for (UINT iPass = 0; iPass < countPass; ++iPass) {
+			effectShot_->BeginPass(iPass);
+			device->DrawPrimitive(D3DPT_TRIANGLELIST, 0, countQuad * 2);
+			effectShot_->EndPass();
+		}
+		effectShot_->End();
+	}
+
+	batchQuad_->Clear();
+}
 void StgShotManager::LoadRenderQueue() {
 	for (size_t i = 0; i < listRenderQueuePlayer_.size(); ++i) {
 		listRenderQueuePlayer_[i].count = 0;
+		listRenderQueuePlayer_[i].listCount.fill(0);
 		listRenderQueueEnemy_[i].count = 0;
+		listRenderQueueEnemy_[i].listCount.fill(0);
 	}
 
+	BlendMode listBlend[2];
 	for (ref_unsync_ptr<StgShotObject>& obj : listObj_) {
 		if (obj->IsDeleted() || !obj->IsActive() || !obj->IsVisible()) continue;
 
-		auto& [count, listShot] = (obj->GetOwnerType() == StgShotObject::OWNER_PLAYER ?
+		RenderQueue& queue = (obj->GetOwnerType() == StgShotObject::OWNER_PLAYER ?
 			listRenderQueuePlayer_ : listRenderQueueEnemy_)[obj->GetRenderPriorityI()];
 
-		while (count >= listShot.size())
-			listShot.resize(listShot.size() * 2);
-		listShot[count++] = obj.get();
+		size_t countBlend = obj->GetRenderBlendTypes(listBlend);
+		for (size_t i = 0; i < countBlend; ++i) {
+			int iBlend = _GetBlendRenderIndex(listBlend[i]);
+			if (iBlend < 0) continue;	//Never rendered
+
+			size_t& count = queue.listCount[iBlend];
+			std::vector<StgShotObject*>& listShot = queue.listShot[iBlend];
+			while (count >= listShot.size())
+				listShot.resize(listShot.size() * 2);
+			listShot[count++] = obj.get();
+			++queue.count;
+		}
 	}
 }
 
@@ -163,6 +258,13 @@ void StgShotManager::AddShot(ref_unsync_ptr<StgShotObject> obj) {
 	obj->SetOwnObjectReference();
 	listObj_.push_back(obj);
 }
+void StgShotManager::AddShotBatch(std::vector<ref_unsync_ptr<StgShotObject>>& listShot, size_t count) {
+	count = std::min(count, listShot.size());
+	for (size_t i = 0; i < count; ++i) {
+		listShot[i]->SetOwnObjectReference();
+		listObj_.push_back(listShot[i]);
+	}
+}
 
 size_t StgShotManager::DeleteInCircle(int typeDelete, int typeTo, int typeOwner, int cx, int cy, int* radius) {
 	int r = radius ? *radius : 0;
@@ -850,6 +952,143 @@ HRESULT StgShotVertexBufferContainer::LoadData(const std::vector<VERTEX_TLX>& da
 	return hr;
 }
 
+//****************************************************************************
+//StgShotQuadBatch
+//****************************************************************************
+//Triangle list order of the quad corners, matching the strip order of the shot vertex buffers
+const size_t StgShotQuadBatch::QUAD_CORNER_ORDER[VERTEX_PER_QUAD] = { 0, 1, 2, 2, 1, 3 };
+
+StgShotQuadBatch::StgShotQuadBatch() {
+	count_ = 0;
+	texture_ = nullptr;
+}
+void StgShotQuadBatch::Clear() {
+	count_ = 0;
+	texture_ = nullptr;
+
+	for (auto pList : { &listLeft_, &listTop_, &listRight_, &listBottom_,
+		&listU0_, &listV0_, &listU1_, &listV1_,
+		&listM00_, &listM01_, &listM10_, &listM11_, &listPosX_, &listPosY_ })
+	{
+		pList->clear();
+	}
+	listColor_.clear();
+}
+void StgShotQuadBatch::Add(const StgShotQuadParam& quad) {
+	StgShotVertexBufferContainer* pVB = quad.frame->GetVertexBufferContainer();
+	if (count_ == 0)
+		texture_ = pVB->GetD3DTexture();
+
+	//Same values StgShotDataList::_LoadVertexBuffers puts in the static buffers
+	{
+		const float mul = DirectGraphics::g_dxCoordsMul_;
+		const DxRect<float>* rcDst = quad.frame->GetDestRect();
+		listLeft_.push_back(rcDst->left * mul);
+		listTop_.push_back(rcDst->top * mul);
+		listRight_.push_back(rcDst->right * mul);
+		listBottom_.push_back(rcDst->bottom * mul);
+	}
+	{
+		shared_ptr<Texture> texture = pVB->GetTexture();
+		float texW = texture ? (float)texture->GetWidth() : 1.0f;
+		float texH = texture ? (float)texture->GetHeight() : 1.0f;
+
+		const DxRect<LONG>* rcSrc = quad.frame->GetSourceRect();
+		listU0_.push_back(rcSrc->left / texW);
+		listV0_.push_back(rcSrc->top / texH);
+		listU1_.push_back(rcSrc->right / texW);
+		listV1_.push_back(rcSrc->bottom / texH);
+	}
+
+	const D3DXMATRIX& mat = quad.matTransform;
+	listM00_.push_back(mat._11);
+	listM01_.push_back(mat._12);
+	listM10_.push_back(mat._21);
+	listM11_.push_back(mat._22);
+	listPosX_.push_back(mat._41);
+	listPosY_.push_back(mat._42);
+
+	listColor_.push_back(quad.color);
+
+	++count_;
+}
+
+void StgShotQuadBatch::_WriteQuad(VERTEX_TLX* dst, size_t index, const float* cornerX, const float* cornerY) {
+	D3DCOLOR color = listColor_[index];
+	float u[2] = { listU0_[index], listU1_[index] };
+	float v[2] = { listV0_[index], listV1_[index] };
+
+	for (size_t iVert = 0; iVert < VERTEX_PER_QUAD; ++iVert) {
+		size_t iCorner = QUAD_CORNER_ORDER[iVert];
+		VERTEX_TLX* pv = &dst[iVert];
+
+		pv->position = D3DXVECTOR4(cornerX[iCorner], cornerY[iCorner], 0, 1);
+		pv->diffuse_color = color;
+		pv->texcoord = D3DXVECTOR2(u[iCorner & 1], v[iCorner >> 1]);
+	}
+}
+void StgShotQuadBatch::GenerateScalar(VERTEX_TLX* dst, size_t begin, size_t count) {
+	for (size_t i = begin; i < begin + count; ++i) {
+		float m00 = listM00_[i], m01 = listM01_[i];
+		float m10 = listM10_[i], m11 = listM11_[i];
+		float localX[4] = { listLeft_[i], listRight_[i], listLeft_[i], listRight_[i] };
+		float localY[4] = { listTop_[i], listTop_[i], listBottom_[i], listBottom_[i] };
+
+		float cornerX[4];
+		float cornerY[4];
+		for (size_t iCorner = 0; iCorner < 4; ++iCorner) {
+			cornerX[iCorner] = (localX[iCorner] * m00 + localY[iCorner] * m10) + listPosX_[i];
+			cornerY[iCorner] = (localX[iCorner] * m01 + localY[iCorner] * m11) + listPosY_[i];
+		}
+
+		_WriteQuad(dst, i, cornerX, cornerY);
+		dst += VERTEX_PER_QUAD;
+	}
+}
+void StgShotQuadBatch::GenerateVector(VERTEX_TLX* dst, size_t begin, size_t count) {
+	//4 quads per iteration, one per lane; the remainder goes through the scalar path
+	size_t countVector = count & ~(size_t)3;
+	for (size_t i = begin; i < begin + countVector; i += 4) {
+		__m128 m00 = Vectorize::Load(&listM00_[i]);
+		__m128 m01 = Vectorize::Load(&listM01_[i]);
+		__m128 m10 = Vectorize::Load(&listM10_[i]);
+		__m128 m11 = Vectorize::Load(&listM11_[i]);
+		__m128 posX = Vectorize::Load(&listPosX_[i]);
+		__m128 posY = Vectorize::Load(&listPosY_[i]);
+
+		__m128 localX[4];
+		__m128 localY[4];
+		localX[0] = localX[2] = Vectorize::Load(&listLeft_[i]);
+		localX[1] = localX[3] = Vectorize::Load(&listRight_[i]);
+		localY[0] = localY[1] = Vectorize::Load(&listTop_[i]);
+		localY[2] = localY[3] = Vectorize::Load(&listBottom_[i]);
+
+		//[corner][lane]
+		float cornerX[4][4];
+		float cornerY[4][4];
+		for (size_t iCorner = 0; iCorner < 4; ++iCorner) {
+			__m128 x = Vectorize::Add(Vectorize::Mul(localX[iCorner], m00), Vectorize::Mul(localY[iCorner], m10));
+			__m128 y = Vectorize::Add(Vectorize::Mul(localX[iCorner], m01), Vectorize::Mul(localY[iCorner], m11));
+			Vectorize::Store(cornerX[iCorner], Vectorize::Add(x, posX));
+			Vectorize::Store(cornerY[iCorner], Vectorize::Add(y, posY));
+		}
+
+		for (size_t iLane = 0; iLane < 4; ++iLane) {
+			float laneX[4] = { cornerX[0][iLane], cornerX[1][iLane], cornerX[2][iLane], cornerX[3][iLane] };
+			float laneY[4] = { cornerY[0][iLane], cornerY[1][iLane], cornerY[2][iLane], cornerY[3][iLane] };
+			_WriteQuad(dst, i + iLane, laneX, laneY);
+			dst += VERTEX_PER_QUAD;
+		}
+	}
+	GenerateScalar(dst, begin + countVector, count - countVector);
+}
+std::vector<VERTEX_TLX>& StgShotQuadBatch::Generate() {
+	bufferVertex_.resize(count_ * VERTEX_PER_QUAD);
+	if (count_ > 0)
+		GenerateVector(bufferVertex_.data(), 0, count_);
+	return bufferVertex_;
+}
+
 //****************************************************************************
 //StgShotObject
 //****************************************************************************
@@ -893,8 +1132,7 @@ StgShotObject::StgShotObject(StgStageController* stageController) : StgMoveObjec
 
 	hitboxScale_ = D3DXVECTOR2(1.0f, 1.0f);
 
-	timerTransform_ = 0;
-	timerTransformNext_ = 0;
+	stateTransform_ = { 0, 0 };
 
 	int priShotI = stageController_->GetStageInformation()->GetShotObjectPriority();
 	SetRenderPriorityI(priShotI);
@@ -949,9 +1187,8 @@ void StgShotObject::Clone(DxScriptObjectBase* _src) {
 	bRoundingPosition_ = src->bRoundingPosition_;
 	roundingAngle_ = src->roundingAngle_;
 
-	listTransformationShotAct_ = src->listTransformationShotAct_;
-	timerTransform_ = src->timerTransform_;
-	timerTransformNext_ = src->timerTransformNext_;
+	programTransform_ = src->programTransform_;
+	stateTransform_ = src->stateTransform_;
 }
 
 void StgShotObject::SetOwnObjectReference() {
@@ -1148,6 +1385,20 @@ void StgShotObject::_SetVertexUV(VERTEX_TLX* vertex, float u, float v) {
 void StgShotObject::_SetVertexColorARGB(VERTEX_TLX* vertex, D3DCOLOR color) {
 	vertex->diffuse_color = color;
 }
+size_t StgShotObject::GetRenderBlendTypes(BlendMode* listRes) {
+	if (_GetShotData() == nullptr) return 0;
+
+	//Lasers fall back to additive for both parts and may draw either, report both
+	BlendMode blendMain = GetBlendType();
+	BlendMode blendDelay = GetDelayBlendType();
+	if (blendMain == MODE_BLEND_NONE) blendMain = MODE_BLEND_ADD_ARGB;
+	if (blendDelay == MODE_BLEND_NONE) blendDelay = MODE_BLEND_ADD_ARGB;
+
+	listRes[0] = blendMain;
+	if (blendDelay == blendMain) return 1;
+	listRes[1] = blendDelay;
+	return 2;
+}
 void StgShotObject::SetAlpha(int alpha) {
 	ColorAccess::ClampColor(alpha);
 	color_ = (color_ & 0x00ffffff) | ((byte)alpha << 24);
@@ -1175,15 +1426,22 @@ void StgShotObject::DeleteImmediate() {
 }
 
 void StgShotObject::_ProcessTransformAct() {
-	if (listTransformationShotAct_.size() == 0) return;
+	if (programTransform_ == nullptr) return;
 
-	if (timerTransform_ == 0) timerTransform_ = delay_.time;
-	while (timerTransform_ == frameWork_ && listTransformationShotAct_.size() > 0) {
-		StgShotPatternTransform& transform = listTransformationShotAct_.front();
+	const StgShotTransformProgram* program = programTransform_.get();
+	if (stateTransform_.pc >= program->GetSize()) {
+		programTransform_ = nullptr;
+		return;
+	}
+
+	int& timerTransform = stateTransform_.timer;
+	if (timerTransform == 0) timerTransform = delay_.time;
+	while (timerTransform == frameWork_ && stateTransform_.pc < program->GetSize()) {
+		const StgShotPatternTransform& transform = program->GetInstruction(stateTransform_.pc);
 
 		switch (transform.act) {
 		case StgShotPatternTransform::TRANSFORM_WAIT:
-			timerTransform_ += std::max((int)transform.param[0], 0);
+			timerTransform += std::max((int)transform.param[0], 0);
 			break;
 		case StgShotPatternTransform::TRANSFORM_ADD_SPEED_ANGLE:
 		{
@@ -1239,7 +1497,7 @@ void StgShotObject::_ProcessTransformAct() {
 			double changeSpeed = transform.param[3];
 			double changeAngle = transform.param[4];
 
-			timerTransform_ += timer * countRep;
+			timerTransform += timer * countRep;
 
 			for (int framePattern = 0; countRep > 0; --countRep, framePattern += timer) {
 				double nowSpeed = GetSpeed();
@@ -1500,7 +1758,7 @@ void StgShotObject::_ProcessTransformAct() {
 			break;
 		}
 
-		listTransformationShotAct_.pop_front();
+		++stateTransform_.pc;
 	}
 }
 
@@ -1711,12 +1969,34 @@ void StgShotObject::_DefaultShotRender(StgShotData* shotData, StgShotDataFrame*
 	}
 }
 
+size_t StgNormalShotObject::GetRenderBlendTypes(BlendMode* listRes) {
+	StgShotData* shotData = _GetShotData();
+	if (shotData == nullptr) return 0;
+
+	//Same resolution as in Render
+	BlendMode objBlendType;
+	if (delay_.time > 0) {
+		objBlendType = GetDelayBlendType();
+		objBlendType = objBlendType == MODE_BLEND_NONE ? shotData->GetDelayRenderType() : objBlendType;
+	}
+	else {
+		objBlendType = GetBlendType();
+		objBlendType = objBlendType == MODE_BLEND_NONE ? shotData->GetRenderType() : objBlendType;
+	}
+	listRes[0] = objBlendType;
+	return 1;
+}
 void StgNormalShotObject::Render(BlendMode targetBlend) {
 	//if (!IsVisible()) return;
-	StgShotManager* shotManager = stageController_->GetShotManager();
+	StgShotQuadParam quad;
+	if (GetRenderQuad(targetBlend, &quad))
+		_DefaultShotRender(quad.data, quad.frame, quad.matTransform, quad.color);
 
+	//if (bIntersected_) color = D3DCOLOR_ARGB(255, 255, 0, 0);
+}
+bool StgNormalShotObject::GetRenderQuad(BlendMode targetBlend, StgShotQuadParam* quad) {
 	StgShotData* shotData = _GetShotData();
-	if (shotData == nullptr) return;
+	if (shotData == nullptr) return false;
 
 	FLOAT sposx = position_.x;
 	FLOAT sposy = position_.y;
@@ -1729,22 +2009,26 @@ void StgNormalShotObject::Render(BlendMode targetBlend) {
 	float scaleY = 1.0f;
 	D3DCOLOR color;
 
-	auto _Render = [&](StgShotData* pData, StgShotDataFrame* pFrame) {
-		if (pData == nullptr || pFrame == nullptr) return;
+	auto _SetQuad = [&](StgShotData* pData, StgShotDataFrame* pFrame) -> bool {
+		if (pData == nullptr || pFrame == nullptr) return false;
+		if (pFrame->GetVertexBufferContainer() == nullptr) return false;
 
-		D3DXMATRIX matTransform(
+		quad->data = pData;
+		quad->frame = pFrame;
+		quad->matTransform = D3DXMATRIX(
 			scaleX * move_.x, scaleX * move_.y, 0, 0,
 			scaleY * -move_.y, scaleY * move_.x, 0, 0,
 			0, 0, 1, 0,
 			sposx, sposy, 0, 1
 		);
-		_DefaultShotRender(pData, pFrame, matTransform, color);
+		quad->color = color;
+		return true;
 	};
 
 	if (delay_.time > 0) {
 		BlendMode objBlendType = GetDelayBlendType();
 		objBlendType = objBlendType == MODE_BLEND_NONE ? shotData->GetDelayRenderType() : objBlendType;
-		if (objBlendType != targetBlend) return;
+		if (objBlendType != targetBlend) return false;
 
 		StgShotData* delayData = _GetShotData(delay_.id >= 0 ? delay_.id : shotData->GetDefaultDelayID());
 		if (delayData) {
@@ -1763,13 +2047,14 @@ void StgNormalShotObject::Render(BlendMode targetBlend) {
 				color = (color & 0x00ffffff) | (alpha << 24);
 			}
 
-			_Render(delayData, delayFrame);
+			return _SetQuad(delayData, delayFrame);
 		}
+		return false;
 	}
 	else {
 		BlendMode objBlendType = GetBlendType();
 		objBlendType = objBlendType == MODE_BLEND_NONE ? shotData->GetRenderType() : objBlendType;
-		if (objBlendType != targetBlend) return;
+		if (objBlendType != targetBlend) return false;
 
 		scaleX = scale_.x;
 		scaleY = scale_.y;
@@ -1784,10 +2069,8 @@ void StgNormalShotObject::Render(BlendMode targetBlend) {
 		}
 
 		StgShotDataFrame* shotFrame = shotData->GetFrame(frameWork_);
-		_Render(shotData, shotFrame);
+		return _SetQuad(shotData, shotFrame);
 	}
-
-	//if (bIntersected_) color = D3DCOLOR_ARGB(255, 255, 0, 0);
 }
 
 void StgNormalShotObject::_SendDeleteEvent(TypeDelete type) {
@@ -3034,6 +3317,7 @@ void StgCurveLaserObject::_SendDeleteEvent(TypeDelete type) {
 //****************************************************************************
 StgShotPatternGeneratorObject::StgShotPatternGeneratorObject(StgStageController* stageController) : StgObjectBase(stageController) {
 	typeObject_ = TypeObject::ShotPattern;
+	bCleanUpRequired_ = true;
 	bAutoDelete_ = false;
 
 	idShotData_ = -1;
@@ -3106,13 +3390,24 @@ void StgShotPatternGeneratorObject::Clone(DxScriptObjectBase* _src) {
 	laserLength_ = src->laserLength_;
 
 	listTransformation_ = src->listTransformation_;
+	programTransform_ = src->programTransform_;
 }
 
 void StgShotPatternGeneratorObject::SetTransformation(size_t off, StgShotPatternTransform& entry) {
 	if (off >= listTransformation_.size()) listTransformation_.resize(off + 1);
 	listTransformation_[off] = entry;
+	programTransform_ = nullptr;
 }
 
+shared_ptr<const StgShotTransformProgram> StgShotPatternGeneratorObject::_GetTransformProgram() {
+	//Compiled once and reused by every FireSet until the transforms are changed
+	if (programTransform_ == nullptr && listTransformation_.size() > 0) {
+		auto program = std::make_shared<StgShotTransformProgram>(listTransformation_);
+		if (program->GetSize() > 0)
+			programTransform_ = program;
+	}
+	return programTransform_;
+}
 void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController* controller, std::vector<int>* idVector) {
 	if (idVector) idVector->clear();
 
@@ -3136,71 +3431,18 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 	basePosX += basePointOffsetX_;
 	basePosY += basePointOffsetY_;
 
-	std::list<StgShotPatternTransform> transformAsList;
-	for (StgShotPatternTransform& iTransform : listTransformation_)
-		transformAsList.push_back(iTransform);
-
-	auto __CreateShot = [&](float _x, float _y, double _ss, double _sa) -> bool {
-		if (shotManager->GetShotCountAll() >= StgShotManager::SHOT_MAX) return false;
-
-		ref_unsync_ptr<StgShotObject> objShot;
-		switch (typeShot_) {
-		case TypeObject::Shot:
-		{
-			ref_unsync_ptr<StgNormalShotObject> ptrShot = new StgNormalShotObject(controller);
-			objShot = ptrShot;
-			break;
-		}
-		case TypeObject::LooseLaser:
-		{
-			ref_unsync_ptr<StgLooseLaserObject> ptrShot = new StgLooseLaserObject(controller);
-			ptrShot->SetLength(laserLength_);
-			ptrShot->SetRenderWidth(laserWidth_);
-			objShot = ptrShot;
-			break;
-		}
-		case TypeObject::StraightLaser:
-		{
-			ref_unsync_ptr<StgStraightLaserObject> ptrShot = new StgStraightLaserObject(controller);
-			ptrShot->SetLength(laserLength_);
-			ptrShot->SetRenderWidth(laserWidth_);
-			objShot = ptrShot;
-			break;
-		}
-		case TypeObject::CurveLaser:
-		{
-			ref_unsync_ptr<StgCurveLaserObject> ptrShot = new StgCurveLaserObject(controller);
-			ptrShot->SetLength(laserLength_);
-			ptrShot->SetRenderWidth(laserWidth_);
-			objShot = ptrShot;
-			break;
-		}
-		}
-
-		if (objShot == nullptr) return false;
-
-		objShot->SetX(_x);
-		objShot->SetY(_y);
-		objShot->SetSpeed(_ss);
-		objShot->SetDirectionAngle(_sa);
-		objShot->SetShotDataID(idShotData_);
-		objShot->SetDelay(delay_);
-		objShot->SetOwnerType(typeOwner_);
-
-		objShot->SetTransformList(transformAsList);
-
-		objShot->SetBlendType(iniBlendType_);
-		//objShot->SetEnableDelayMotion(delayMove_);
-
-		int idRes = script->AddObject(objShot);
-		if (idRes == DxScript::ID_INVALID) return false;
-
-		shotManager->AddShot(objShot);
-
-		if (idVector) idVector->push_back(idRes);
+	//Shot parameters are collected first and the shots are created in one batch afterwards
+	struct ShotSpawn {
+		float x;
+		float y;
+		double speed;
+		double angle;
+	};
+	std::vector<ShotSpawn> listSpawn;
+	listSpawn.reserve(shotWay_ * shotStack_);
 
-		if (shotParent_) shotParent_->AddChild(shotParent_, objShot);
-		return true;
+	auto __PushShot = [&](float _x, float _y, double _ss, double _sa) {
+		listSpawn.push_back({ _x, _y, _ss, _sa });
 	};
 
 	{
@@ -3224,7 +3466,7 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 					float sx = basePosX + fireRadiusOffset_ * r_fac[0];
 					float sy = basePosY + fireRadiusOffset_ * r_fac[1];
 
-					__CreateShot(sx, sy, ss, sa);
+					__PushShot(sx, sy, ss, sa);
 				}
 			}
 			break;
@@ -3247,7 +3489,7 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 					float sx = basePosX + fireRadiusOffset_ * cos(sa);
 					float sy = basePosY + fireRadiusOffset_ * sin(sa);
 
-					__CreateShot(sx, sy, ss, sa);
+					__PushShot(sx, sy, ss, sa);
 				}
 			}
 			break;
@@ -3285,7 +3527,7 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 					float sx = basePosX + fireRadiusOffset_ * cos(sa);
 					float sy = basePosY + fireRadiusOffset_ * sin(sa);
 
-					__CreateShot(sx, sy, ss, sa);
+					__PushShot(sx, sy, ss, sa);
 				}
 			}
 			break;
@@ -3323,7 +3565,7 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 					double sa = atan2(_sy, _sx);
 					double ss = hypot(_sx, _sy) * speedBase_;
 
-					__CreateShot(sx, sy, ss, sa);
+					__PushShot(sx, sy, ss, sa);
 				}
 			}
 			break;
@@ -3348,7 +3590,7 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 				float sx = basePosX + fireRadiusOffset_ * rpos[0];
 				float sy = basePosY + fireRadiusOffset_ * rpos[1];
 
-				__CreateShot(sx, sy, ss, sa);
+				__PushShot(sx, sy, ss, sa);
 			}
 			break;
 		}
@@ -3371,7 +3613,7 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 					float sx = basePosX + fireRadiusOffset_ * cos(sa);
 					float sy = basePosY + fireRadiusOffset_ * sin(sa);
 
-					__CreateShot(sx, sy, ss, sa);
+					__PushShot(sx, sy, ss, sa);
 				}
 			}
 			break;
@@ -3406,7 +3648,7 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 					double ss = speedBase_;
 					if (shotStack_ > 1) ss += (speedArgument_ - speedBase_) * (iStack / ((double)shotStack_ - 1));
 
-					__CreateShot(sx, sy, ss * _ss, sa);
+					__PushShot(sx, sy, ss * _ss, sa);
 				}
 			}
 			break;
@@ -3433,11 +3675,105 @@ void StgShotPatternGeneratorObject::FireSet(void* scriptData, StgStageController
 					float sx = basePosX + fireRadiusOffset_ * cos(sa);
 					float sy = basePosY + fireRadiusOffset_ * sin(sa);
 
-					__CreateShot(sx, sy, ss, sa);
+					__PushShot(sx, sy, ss, sa);
 				}
 			}
 			break;
 		}
 		}
 	}
-}
\ No newline at end of file
+
+	size_t countShotMax = StgShotManager::SHOT_MAX - std::min(shotManager->GetShotCountAll(), (size_t)StgShotManager::SHOT_MAX);
+	size_t countSpawn = std::min(listSpawn.size(), countShotMax);
+	if (countSpawn == 0) return;
+
+	shared_ptr<const StgShotTransformProgram> program = _GetTransformProgram();
+
+	std::vector<ref_unsync_ptr<StgShotObject>> listShot;
+	listShot.reserve(countSpawn);
+	for (size_t iSpawn = 0; iSpawn < countSpawn; ++iSpawn) {
+		const ShotSpawn& spawn = listSpawn[iSpawn];
+
+		ref_unsync_ptr<StgShotObject> objShot;
+		switch (typeShot_) {
+		case TypeObject::Shot:
+		{
+			ref_unsync_ptr<StgNormalShotObject> ptrShot = new StgNormalShotObject(controller);
+			objShot = ptrShot;
+			break;
+		}
+		case TypeObject::LooseLaser:
+		{
+			ref_unsync_ptr<StgLooseLaserObject> ptrShot = new StgLooseLaserObject(controller);
+			ptrShot->SetLength(laserLength_);
+			ptrShot->SetRenderWidth(laserWidth_);
+			objShot = ptrShot;
+			break;
+		}
+		case TypeObject::StraightLaser:
+		{
+			ref_unsync_ptr<StgStraightLaserObject> ptrShot = new StgStraightLaserObject(controller);
+			ptrShot->SetLength(laserLength_);
+			ptrShot->SetRenderWidth(laserWidth_);
+			objShot = ptrShot;
+			break;
+		}
+		case TypeObject::CurveLaser:
+		{
+			ref_unsync_ptr<StgCurveLaserObject> ptrShot = new StgCurveLaserObject(controller);
+			ptrShot->SetLength(laserLength_);
+			ptrShot->SetRenderWidth(laserWidth_);
+			objShot = ptrShot;
+			break;
+		}
+		}
+
+		if (objShot == nullptr) return;
+
+		objShot->SetX(spawn.x);
+		objShot->SetY(spawn.y);
+		objShot->SetSpeed(spawn.speed);
+		objShot->SetDirectionAngle(spawn.angle);
+		objShot->SetShotDataID(idShotData_);
+		objShot->SetDelay(delay_);
+		objShot->SetOwnerType(typeOwner_);
+
+		objShot->SetTransformProgram(program);
+
+		objShot->SetBlendType(iniBlendType_);
+		//objShot->SetEnableDelayMotion(delayMove_);
+
+		listShot.push_back(objShot);
+	}
+
+	size_t countAdded = script->AddObjectBatch(listShot, idVector);
+	shotManager->AddShotBatch(listShot, countAdded);
+
+	if (shotParent_) {
+		for (size_t iShot = 0; iShot < countAdded; ++iShot)
+			shotParent_->AddChild(shotParent_, listShot[iShot]);
+	}
+}
+
+//****************************************************************************
+//StgShotTransformProgram
+//****************************************************************************
+StgShotTransformProgram::StgShotTransformProgram(const std::vector<StgShotPatternTransform>& listTransform) {
+	listCode_.reserve(listTransform.size());
+	for (const StgShotPatternTransform& transform : listTransform) {
+		if (transform.act > StgShotPatternTransform::TRANSFORM_ADDPATTERN_C2)
+			continue;	//Unknown or unset entries do nothing when run
+
+		//Consecutive waits are merged, they're run back to back anyway
+		if (transform.act == StgShotPatternTransform::TRANSFORM_WAIT && listCode_.size() > 0
+			&& listCode_.back().act == StgShotPatternTransform::TRANSFORM_WAIT)
+		{
+			double& wait = listCode_.back().param[0];
+			wait = (double)(std::max((int)wait, 0) + std::max((int)transform.param[0], 0));
+			continue;
+		}
+
+		listCode_.push_back(transform);
+	}
+	listCode_.shrink_to_fit();
+}
@@ -9,6 +9,7 @@ class StgShotDataList;
 class StgShotData;
 struct StgShotDataFrame;
 class StgShotVertexBufferContainer;
+class StgShotQuadBatch;
 class StgShotObject;
 //*******************************************************************
 //StgShotManager
@@ -40,12 +41,16 @@ public:
 
 		BLEND_COUNT = 8,
 	};
-protected:
-	static std::array<BlendMode, BLEND_COUNT> blendTypeRenderOrder;
+
+	//Shots bucketed by blend mode in one pass, each bucket keeps the order of listObj_
 	struct RenderQueue {
 		size_t count;
-		std::vector<StgShotObject*> listShot;
+		std::array<size_t, BLEND_COUNT> listCount;		//Indexed as in blendTypeRenderOrder
+		std::array<std::vector<StgShotObject*>, BLEND_COUNT> listShot;
 	};
+protected:
+	static std::array<BlendMode, BLEND_COUNT> blendTypeRenderOrder;
+	static int _GetBlendRenderIndex(BlendMode blend);
 protected:
 	StgStageController* stageController_;
 
@@ -65,6 +70,10 @@ protected:
 
 	ID3DXEffect* effectShot_;
 	D3DXMATRIX matProj_;
+
+	unique_ptr<StgShotQuadBatch> batchQuad_;
+
+	void _RenderQuadBatch();
 public:
 	IDirect3DTexture9* pLastTexture_;
 public:
@@ -78,6 +87,7 @@ public:
 	void RegistIntersectionTarget();
 
 	void AddShot(ref_unsync_ptr<StgShotObject> obj);
+	void AddShotBatch(std::vector<ref_unsync_ptr<StgShotObject>>& listShot, size_t count);
 
 	ID3DXEffect* GetEffect() { return effectShot_; }
 	D3DXMATRIX* GetProjectionMatrix() { return &matProj_; }
@@ -103,9 +113,15 @@ public:
 	std::vector<int> GetLaserIdAll(int typeOwner);
 	size_t GetShotCount(int typeOwner);
 	size_t GetShotCountAll() { return listObj_.size(); }
+	std::list<ref_unsync_ptr<StgShotObject>>& GetShotList() { return listObj_; }
 
 	void SetDeleteEventEnableByType(int type, bool bEnable);
 	bool IsDeleteEventEnable(TypeDelete bit) { return listDeleteEventEnable_[(int)bit]; }
+
+	const RenderQueue* GetRenderQueue(bool bPlayer, int priority) {
+		std::vector<RenderQueue>& listQueue = bPlayer ? listRenderQueuePlayer_ : listRenderQueueEnemy_;
+		return (priority >= 0 && priority < listQueue.size()) ? &listQueue[priority] : nullptr;
+	}
 };
 
 //*******************************************************************
@@ -234,11 +250,80 @@ public:
 	IDirect3DTexture9* GetD3DTexture() { return texture_ ? texture_->GetD3DTexture() : nullptr; }
 };
 
+//*******************************************************************
+//StgShotQuadBatch
+//*******************************************************************
+//What a normal shot draws in a frame, in the form _DefaultShotRender takes it
+struct StgShotQuadParam {
+	StgShotData* data;
+	StgShotDataFrame* frame;
+	D3DXMATRIX matTransform;
+	D3DCOLOR color;
+};
+
+//Consecutive normal shot quads sharing a texture, stored as structure-of-arrays and
+//	expanded into pre-transformed triangle list vertices for a single draw call
+class StgShotQuadBatch {
+public:
+	enum : size_t {
+		VERTEX_PER_QUAD = 6,
+		MAX_QUAD = VertexBufferManager::MAX_STRIDE_STATIC / VERTEX_PER_QUAD,
+	};
+private:
+	static const size_t QUAD_CORNER_ORDER[VERTEX_PER_QUAD];
+
+	size_t count_;
+	IDirect3DTexture9* texture_;
+
+	//Local rect, already scaled by g_dxCoordsMul_
+	std::vector<float> listLeft_;
+	std::vector<float> listTop_;
+	std::vector<float> listRight_;
+	std::vector<float> listBottom_;
+	//[u0, v0] -> [u1, v1]
+	std::vector<float> listU0_;
+	std::vector<float> listV0_;
+	std::vector<float> listU1_;
+	std::vector<float> listV1_;
+	//2x2 rotation/scale rows and translation of the world matrix
+	std::vector<float> listM00_;
+	std::vector<float> listM01_;
+	std::vector<float> listM10_;
+	std::vector<float> listM11_;
+	std::vector<float> listPosX_;
+	std::vector<float> listPosY_;
+	std::vector<D3DCOLOR> listColor_;
+
+	std::vector<VERTEX_TLX> bufferVertex_;
+
+	inline void _WriteQuad(VERTEX_TLX* dst, size_t index, const float* cornerX, const float* cornerY);
+public:
+	StgShotQuadBatch();
+
+	void Clear();
+	void Add(const StgShotQuadParam& quad);
+
+	size_t GetCount() { return count_; }
+	bool IsFull() { return count_ >= MAX_QUAD; }
+	IDirect3DTexture9* GetTexture() { return texture_; }
+
+	//Both write count * VERTEX_PER_QUAD vertices, the SSE path is bit-identical to the scalar one
+	void GenerateScalar(VERTEX_TLX* dst, size_t begin, size_t count);
+	void GenerateVector(VERTEX_TLX* dst, size_t begin, size_t count);
+
+	std::vector<VERTEX_TLX>& Generate();
+};
+
 //*******************************************************************
 //StgShotObject
 //*******************************************************************
 struct StgShotPatternTransform;
+class StgShotTransformProgram;
 class StgShotObject : public DxScriptShaderObject, public StgMoveObject, public StgIntersectionObject {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = {
+		TypeObject::Shot, TypeObject::LooseLaser, TypeObject::StraightLaser, TypeObject::CurveLaser
+	};
 protected:
 	using TypeDelete = StgShotManager::TypeDelete;
 public:
@@ -366,9 +451,12 @@ protected:
 
 	inline void _DefaultShotRender(StgShotData* shotData, StgShotDataFrame* shotFrame, const D3DXMATRIX& matWorld, D3DCOLOR color);
 protected:
-	std::list<StgShotPatternTransform> listTransformationShotAct_;
-	int timerTransform_;
-	int timerTransformNext_;
+	struct TransformState {
+		size_t pc;			//Next instruction in programTransform_
+		int timer;
+	};
+	shared_ptr<const StgShotTransformProgram> programTransform_;
+	TransformState stateTransform_;
 
 	void _ProcessTransformAct();
 public:
@@ -385,6 +473,9 @@ public:
 	virtual void Render() {};
 	virtual void Render(BlendMode targetBlend) = 0;
 
+	//Writes the blend modes Render(BlendMode) can draw with this frame (at most 2), returns the count
+	virtual size_t GetRenderBlendTypes(BlendMode* listRes);
+
 	virtual void SetRenderTarget(shared_ptr<Texture> texture) { renderTarget_ = texture; }
 
 	virtual void DeleteImmediate();
@@ -400,8 +491,9 @@ public:
 	virtual void SetAlpha(int alpha);
 	virtual void SetRenderState() {}
 
-	void SetTransformList(const std::list<StgShotPatternTransform>& listTransform) {
-		listTransformationShotAct_ = listTransform;
+	void SetTransformProgram(shared_ptr<const StgShotTransformProgram> program) {
+		programTransform_ = program;
+		stateTransform_.pc = 0;
 	}
 
 	void SetOwnObjectReference();
@@ -473,6 +565,8 @@ public:
 //*******************************************************************
 class StgNormalShotObject : public StgShotObject {
 	friend class StgShotObject;
+public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::Shot };
 protected:
 	double angularVelocity_;
 	bool bFixedAngle_;
@@ -487,6 +581,12 @@ public:
 
 	virtual void Work();
 	virtual void Render(BlendMode targetBlend);
+	virtual size_t GetRenderBlendTypes(BlendMode* listRes);
+
+	//Resolves what Render(targetBlend) would draw, returns false if nothing
+	bool GetRenderQuad(BlendMode targetBlend, StgShotQuadParam* quad);
+	//Without a custom shader or render target, the shot can be drawn through StgShotQuadBatch
+	bool IsBatchRenderable() { return shader_ == nullptr && renderTarget_.expired(); }
 
 	virtual void ClearShotObject() {
 		ClearIntersectionRelativeTarget();
@@ -507,6 +607,10 @@ public:
 //StgLaserObject(レーザー基本部)
 //*******************************************************************
 class StgLaserObject : public StgShotObject {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = {
+		TypeObject::LooseLaser, TypeObject::StraightLaser, TypeObject::CurveLaser
+	};
 protected:
 	int length_;
 	float lengthF_;
@@ -562,6 +666,8 @@ public:
 //StgLooseLaserObject
 //*******************************************************************
 class StgLooseLaserObject : public StgLaserObject {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::LooseLaser };
 protected:
 	Math::DVec2 posTail_;
 	D3DXVECTOR2 posOrigin_;
@@ -589,6 +695,8 @@ public:
 //StgStraightLaserObject (as opposed to StgGayLaserObject)
 //*******************************************************************
 class StgStraightLaserObject : public StgLaserObject {
+public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::StraightLaser };
 protected:
 	double angLaser_;
 	double angVelLaser_;
@@ -646,6 +754,8 @@ public:
 //*******************************************************************
 class StgCurveLaserObject : public StgLaserObject {
 public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::CurveLaser };
+
 	struct LaserNode {
 		StgCurveLaserObject* parent;
 		D3DXVECTOR2 pos;
@@ -709,6 +819,8 @@ public:
 //*******************************************************************
 class StgShotPatternGeneratorObject : public DxScriptObjectBase, public StgObjectBase {
 public:
+	static constexpr TypeObjectMask TYPE_MASK = { TypeObject::ShotPattern };
+
 	enum {
 		PATTERN_TYPE_FAN = 0,
 		PATTERN_TYPE_FAN_AIMED,
@@ -769,6 +881,9 @@ private:
 	int laserLength_;
 
 	std::vector<StgShotPatternTransform> listTransformation_;
+	shared_ptr<const StgShotTransformProgram> programTransform_;	//Compiled from listTransformation_ on demand
+
+	shared_ptr<const StgShotTransformProgram> _GetTransformProgram();
 public:
 	StgShotPatternGeneratorObject(StgStageController* stageController);
 
@@ -778,9 +893,9 @@ public:
 	virtual void SetRenderState() {}
 	virtual void CleanUp();
 
-	void AddTransformation(StgShotPatternTransform& entry) { listTransformation_.push_back(entry); }
+	void AddTransformation(StgShotPatternTransform& entry) { listTransformation_.push_back(entry); programTransform_ = nullptr; }
 	void SetTransformation(size_t off, StgShotPatternTransform& entry);
-	void ClearTransformation() { listTransformation_.clear(); }
+	void ClearTransformation() { listTransformation_.clear(); programTransform_ = nullptr; }
 
 	void SetParent(ref_unsync_ptr<StgMoveObject> obj) { parent_ = obj; }
 	void SetShotParent(ref_unsync_ptr<StgMoveParent> obj) { shotParent_ = obj; }
@@ -847,4 +962,15 @@ struct StgShotPatternTransform {
 	};
 	uint8_t act = 0xff;
 	double param[8];
+};
+
+//Immutable, contiguous form of a transform list, shared by every shot that runs it.
+//	Shots only keep a program counter and timers, see StgShotObject::TransformState.
+class StgShotTransformProgram {
+	std::vector<StgShotPatternTransform> listCode_;
+public:
+	StgShotTransformProgram(const std::vector<StgShotPatternTransform>& listTransform);
+
+	size_t GetSize() const { return listCode_.size(); }
+	const StgShotPatternTransform& GetInstruction(size_t pc) const { return listCode_[pc]; }
 };
\ No newline at end of file
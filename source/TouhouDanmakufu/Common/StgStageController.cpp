@@ -15,6 +15,10 @@ StgStageController::StgStageController(StgSystemController* systemController) {
 	shotManager_ = nullptr;
 	itemManager_ = nullptr;
 	intersectionManager_ = nullptr;
+
+	bReplayDesync_ = false;
+	bHeadless_ = false;
+	frameSeek_ = 0;
 }
 StgStageController::~StgStageController() {
 	objectManagerMain_ = nullptr;
@@ -54,6 +58,16 @@ void StgStageController::Initialize(ref_count_ptr<StgStageStartData> startData)
 	infoStage_ = infoStage;
 	infoStage_->SetReplay(replayStageData != nullptr);
 
+	bHeadless_ = DnhConfiguration::GetInstance()->bHeadless_ && infoStage_->IsReplay();
+	if (bHeadless_) {
+		listHeadlessFrame_.clear();
+		timeHeadlessStart_ = stdch::steady_clock::now();
+	}
+
+	frameSeek_ = 0;
+	if (infoStage_->IsReplay())
+		SetSeekFrame(DnhConfiguration::GetInstance()->replaySeekTime_ * 60U);
+
 	int replayState = infoStage_->IsReplay() ? KeyReplayManager::STATE_REPLAY : KeyReplayManager::STATE_RECORD;
 	keyReplayManager_ = new KeyReplayManager(EDirectInput::GetInstance());
 	keyReplayManager_->SetManageState(replayState);
@@ -266,6 +280,9 @@ void StgStageController::CloseScene() {
 
 		replayStageData->SetLastScore(infoStage_->GetScore());
 	}
+
+	if (bHeadless_)
+		_WriteHeadlessReport();
 }
 void StgStageController::_SetupReplayTargetCommonDataArea(shared_ptr<ManagedScript> pScript) {
 	auto script = std::dynamic_pointer_cast<StgStageScript>(pScript);
@@ -332,6 +349,8 @@ void StgStageController::Work() {
 	}
 	else {
 		if (!bCurrentPause) {
+			auto timeWorkStart = stdch::steady_clock::now();
+
 			//Update replay keys
 			keyReplayManager_->Update();
 
@@ -379,7 +398,26 @@ void StgStageController::Work() {
 				}
 			}
 
+			{
+				DWORD stageFrame = infoStage_->GetCurrentFrame();
+				if (stageFrame % ReplayInformation::StageData::STATE_HASH_INTERVAL == 0)
+					_CheckStateHash(stageFrame);
+
+				if (bHeadless_) {
+					auto timeWork = stdch::steady_clock::now() - timeWorkStart;
+					listHeadlessFrame_.push_back({ stageFrame, ComputeStateHash(),
+						(uint64_t)stdch::duration_cast<stdch::microseconds>(timeWork).count() });
+				}
+			}
+
 			infoStage_->AdvanceFrame();
+
+			if (frameSeek_ > 0 && infoStage_->GetCurrentFrame() >= frameSeek_) {
+				auto timeSeek = stdch::steady_clock::now() - timeSeekStart_;
+				Logger::WriteTop(StringUtility::Format(L"Replay seek to frame %u finished in %.2fms.",
+					frameSeek_, stdch::duration<double, std::milli>(timeSeek).count()));
+				frameSeek_ = 0;
+			}
 		}
 		else {
 			pauseManager_->Work();
@@ -393,6 +431,104 @@ void StgStageController::Work() {
 		logger->SetInfo(8, L"Item count", StringUtility::Format(L"%d", itemManager_->GetItemCount()));
 	}
 }
+void StgStageController::_CheckStateHash(DWORD frame) {
+	ref_count_ptr<ReplayInformation::StageData> replayStageData = infoStage_->GetReplayData();
+	if (replayStageData == nullptr) return;
+
+	uint64_t hash = ComputeStateHash();
+	if (!infoStage_->IsReplay()) {
+		replayStageData->AddStateHash(hash);
+	}
+	else if (!bReplayDesync_) {
+		//Only reported once, everything after the first mismatch is expected to differ
+		size_t index = frame / ReplayInformation::StageData::STATE_HASH_INTERVAL;
+		if (index < replayStageData->GetStateHashCount() && replayStageData->GetStateHash(index) != hash) {
+			bReplayDesync_ = true;
+			Logger::WriteTop(StringUtility::Format(L"Replay desync detected at frame %u "
+				L"(expected %016llx, got %016llx).", frame, replayStageData->GetStateHash(index), hash));
+		}
+	}
+}
+void StgStageController::_WriteHeadlessReport() {
+	auto timeTotal = stdch::steady_clock::now() - timeHeadlessStart_;
+	double msTotal = stdch::duration<double, std::milli>(timeTotal).count();
+
+	size_t countFrame = listHeadlessFrame_.size();
+	double throughput = msTotal > 0 ? countFrame * 1000.0 / msTotal : 0;
+	Logger::WriteTop(StringUtility::Format(L"Headless: Stage %d, %u frames in %.2fms (%.1f fps), %s.",
+		infoStage_->GetStageIndex(), countFrame, msTotal, throughput,
+		bReplayDesync_ ? L"desynced" : L"in sync"));
+
+	const std::wstring& path = DnhConfiguration::GetInstance()->pathHeadlessReport_;
+	File file(path);
+	if (!file.Open(File::WRITE)) {
+		Logger::WriteTop(L"Headless: Failed to open report: " + path);
+		return;
+	}
+	file.SetFilePointerEnd(File::WRITE);
+
+	//Appended per stage, the header is written by the runner
+	std::string str;
+	str.reserve(countFrame * 48U);
+	for (const HeadlessFrame& iFrame : listHeadlessFrame_) {
+		str += StringUtility::Format("%d,%u,%016llx,%llu\n", infoStage_->GetStageIndex(),
+			iFrame.frame, iFrame.hash, iFrame.timeWork);
+	}
+	file.Write(str.data(), (DWORD)str.size());
+	file.Close();
+
+	listHeadlessFrame_.clear();
+}
+bool StgStageController::SetSeekFrame(DWORD frame) {
+	//No snapshots to restore from, seeking re-simulates forward from the current frame
+	if (!infoStage_->IsReplay() || frame <= infoStage_->GetCurrentFrame()) return false;
+
+	frameSeek_ = frame;
+	timeSeekStart_ = stdch::steady_clock::now();
+	return true;
+}
+bool StgStageController::IsSeeking() {
+	return frameSeek_ > 0 && !infoStage_->IsEnd();
+}
+uint64_t StgStageController::ComputeStateHash() {
+	uint64_t hash = HashUtility::FNV_OFFSET;
+
+	hash = HashUtility::Combine(hash, infoStage_->GetCurrentFrame());
+	hash = HashUtility::Fnv1a(infoStage_->GetRandProvider()->GetState(), sizeof(uint64_t) * 4, hash);
+	hash = HashUtility::Combine(hash, infoStage_->GetScore());
+	hash = HashUtility::Combine(hash, infoStage_->GetGraze());
+	hash = HashUtility::Combine(hash, infoStage_->GetPoint());
+
+	//Only STG simulation objects. System and package scripts may create UI objects conditionally (e.g. on IsReplay),
+	//	which also shifts object IDs, so IDs aren't hashed either
+	auto _CombineMoveObject = [&](StgMoveObject* obj) {
+		hash = HashUtility::Combine(hash, obj->GetPositionX());
+		hash = HashUtility::Combine(hash, obj->GetPositionY());
+	};
+
+	if (StgPlayerObject* objPlayer = objectManagerMain_->GetPlayerObject().get()) {
+		hash = HashUtility::Combine(hash, objPlayer->GetState());
+		hash = HashUtility::Combine(hash, objPlayer->GetLife());
+		_CombineMoveObject(objPlayer);
+	}
+	for (auto& obj : enemyManager_->GetEnemyList()) {
+		if (obj == nullptr || obj->IsDeleted()) continue;
+		hash = HashUtility::Combine(hash, obj->GetLife());
+		_CombineMoveObject(obj.get());
+	}
+	for (auto& obj : shotManager_->GetShotList()) {
+		if (obj == nullptr || obj->IsDeleted()) continue;
+		hash = HashUtility::Combine(hash, obj->GetObjectType());
+		_CombineMoveObject(obj.get());
+	}
+	for (auto& obj : itemManager_->GetItemList()) {
+		if (obj == nullptr || obj->IsDeleted()) continue;
+		hash = HashUtility::Combine(hash, obj->GetObjectType());
+		_CombineMoveObject(obj.get());
+	}
+
+	return hash;
+}
 void StgStageController::Render() {
 	bool bPause = infoStage_->IsPause();
 	if (!bPause) {
@@ -18,6 +18,11 @@ class PseudoSlowInformation;
 //StgStageController
 //*******************************************************************
 class StgStageController {
+	struct HeadlessFrame {
+		DWORD frame;
+		uint64_t hash;
+		uint64_t timeWork;	//Microseconds
+	};
 private:
 	StgSystemController* systemController_;
 	ref_count_ptr<StgSystemInformation> infoSystem_;
@@ -33,7 +38,18 @@ private:
 	StgItemManager* itemManager_;
 	StgIntersectionManager* intersectionManager_;
 
+	bool bReplayDesync_;
+
+	bool bHeadless_;
+	stdch::steady_clock::time_point timeHeadlessStart_;
+	std::vector<HeadlessFrame> listHeadlessFrame_;
+
+	DWORD frameSeek_;	//Replays only, updated without rendering until this frame
+	stdch::steady_clock::time_point timeSeekStart_;
+
 	void _SetupReplayTargetCommonDataArea(shared_ptr<ManagedScript> pScript);
+	void _CheckStateHash(DWORD frame);
+	void _WriteHeadlessReport();
 public:
 	StgStageController(StgSystemController* systemController);
 	virtual ~StgStageController();
@@ -46,6 +62,12 @@ public:
 
 	void RenderToTransitionTexture();
 
+	uint64_t ComputeStateHash();
+	bool IsReplayDesync() { return bReplayDesync_; }
+
+	bool SetSeekFrame(DWORD frame);
+	bool IsSeeking();
+
 	StgStageScriptObjectManager* GetMainObjectManager() { return objectManagerMain_.get(); }
 	shared_ptr<StgStageScriptObjectManager> GetMainObjectManagerRef() { return objectManagerMain_; }
 	StgStageScriptManager* GetScriptManager() { return scriptManager_.get(); }
@@ -2750,13 +2750,14 @@ lab_return:
 gstd::value StgStageScript::Func_ObjMove_SetX(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	StgMoveObject* obj = script->GetObjectPointerAs<StgMoveObject>(id);
+	DxScriptObjectBase* objBase = script->GetObjectPointer(id);
+	StgMoveObject* obj = DxScriptObjectBase::CastTo<StgMoveObject>(objBase);
 	if (obj) {
 		double pos = argv[1].as_float();
 		obj->SetPositionX(pos);
 		obj->UpdateRelativePosition();
 
-		if (DxScriptRenderObject* objR = dynamic_cast<DxScriptRenderObject*>(obj)) {
+		if (DxScriptRenderObject* objR = DxScriptObjectBase::CastTo<DxScriptRenderObject>(objBase)) {
 			objR->SetX(pos);
 		}
 	}
@@ -2765,13 +2766,14 @@ gstd::value StgStageScript::Func_ObjMove_SetX(gstd::script_machine* machine, int
 gstd::value StgStageScript::Func_ObjMove_SetY(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	StgMoveObject* obj = script->GetObjectPointerAs<StgMoveObject>(id);
+	DxScriptObjectBase* objBase = script->GetObjectPointer(id);
+	StgMoveObject* obj = DxScriptObjectBase::CastTo<StgMoveObject>(objBase);
 	if (obj) {
 		double pos = argv[1].as_float();
 		obj->SetPositionY(pos);
 		obj->UpdateRelativePosition();
 
-		if (DxScriptRenderObject* objR = dynamic_cast<DxScriptRenderObject*>(obj)) {
+		if (DxScriptRenderObject* objR = DxScriptObjectBase::CastTo<DxScriptRenderObject>(objBase)) {
 			objR->SetY(pos);
 		}
 	}
@@ -2798,7 +2800,8 @@ gstd::value StgStageScript::Func_ObjMove_GetY(gstd::script_machine* machine, int
 gstd::value StgStageScript::Func_ObjMove_SetPosition(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	StgMoveObject* obj = script->GetObjectPointerAs<StgMoveObject>(id);
+	DxScriptObjectBase* objBase = script->GetObjectPointer(id);
+	StgMoveObject* obj = DxScriptObjectBase::CastTo<StgMoveObject>(objBase);
 	if (obj) {
 		double posX = argv[1].as_float();
 		double posY = argv[2].as_float();
@@ -2806,7 +2809,7 @@ gstd::value StgStageScript::Func_ObjMove_SetPosition(gstd::script_machine* machi
 		obj->SetPositionY(posY);
 		obj->UpdateRelativePosition();
 
-		if (DxScriptRenderObject* objR = dynamic_cast<DxScriptRenderObject*>(obj)) {
+		if (DxScriptRenderObject* objR = DxScriptObjectBase::CastTo<DxScriptRenderObject>(objBase)) {
 			objR->SetX(posX);
 			objR->SetY(posY);
 		}
@@ -2866,7 +2869,7 @@ gstd::value StgStageScript::Func_ObjMove_SetAngle(gstd::script_machine* machine,
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
 	DxScriptObjectBase* objBase = script->GetObjectPointer(id);
-	StgMoveObject* obj = dynamic_cast<StgMoveObject*>(objBase);
+	StgMoveObject* obj = DxScriptObjectBase::CastTo<StgMoveObject>(objBase);
 	if (obj) {
 		double angle = Math::DegreeToRadian(argv[1].as_float());
 
@@ -5156,7 +5159,7 @@ gstd::value StgStageScript::Func_ObjShot_SetDelayScalingEnable(gstd::script_mach
 gstd::value StgStageScript::Func_ObjShot_SetGrazeInvalidFrame(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	if (StgShotObject* obj = dynamic_cast<StgShotObject*>(script->GetObjectPointer(id))) {
+	if (StgShotObject* obj = script->GetObjectPointerAs<StgShotObject>(id)) {
 		int frame = argv[1].as_int();
 		obj->SetGrazeInvalidFrame(frame);
 	}
@@ -5165,7 +5168,7 @@ gstd::value StgStageScript::Func_ObjShot_SetGrazeInvalidFrame(gstd::script_machi
 gstd::value StgStageScript::Func_ObjShot_SetGrazeFrame(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	if (StgShotObject* obj = dynamic_cast<StgShotObject*>(script->GetObjectPointer(id))) {
+	if (StgShotObject* obj = script->GetObjectPointerAs<StgShotObject>(id)) {
 		int frame = argv[1].as_int();
 		obj->SetGrazeFrame(frame);
 	}
@@ -5176,7 +5179,7 @@ gstd::value StgStageScript::Func_ObjShot_IsValidGraze(gstd::script_machine* mach
 	int id = argv[0].as_int();
 
 	bool res = false;
-	if (StgShotObject* obj = dynamic_cast<StgShotObject*>(script->GetObjectPointer(id)))
+	if (StgShotObject* obj = script->GetObjectPointerAs<StgShotObject>(id))
 		res = obj->IsValidGraze();
 
 	return script->CreateBooleanValue(res);
@@ -5184,7 +5187,7 @@ gstd::value StgStageScript::Func_ObjShot_IsValidGraze(gstd::script_machine* mach
 gstd::value StgStageScript::Func_ObjShot_SetPenetrateShotEnable(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	if (StgShotObject* obj = dynamic_cast<StgShotObject*>(script->GetObjectPointer(id))) {
+	if (StgShotObject* obj = script->GetObjectPointerAs<StgShotObject>(id)) {
 		bool enable = argv[1].as_boolean();
 		obj->SetPenetrateShotEnable(enable);
 	}
@@ -5193,7 +5196,7 @@ gstd::value StgStageScript::Func_ObjShot_SetPenetrateShotEnable(gstd::script_mac
 gstd::value StgStageScript::Func_ObjShot_SetEnemyIntersectionInvalidFrame(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	if (StgShotObject* obj = dynamic_cast<StgShotObject*>(script->GetObjectPointer(id))) {
+	if (StgShotObject* obj = script->GetObjectPointerAs<StgShotObject>(id)) {
 		int frame = argv[1].as_int();
 		obj->SetEnemyIntersectionInvalidFrame(frame);
 	}
@@ -5202,7 +5205,7 @@ gstd::value StgStageScript::Func_ObjShot_SetEnemyIntersectionInvalidFrame(gstd::
 gstd::value StgStageScript::Func_ObjShot_SetFixedAngle(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	if (StgNormalShotObject* obj = dynamic_cast<StgNormalShotObject*>(script->GetObjectPointer(id))) {
+	if (StgNormalShotObject* obj = script->GetObjectPointerAs<StgNormalShotObject>(id)) {
 		bool bFix = argv[1].as_boolean();
 		obj->SetFixedAngle(bFix);
 	}
@@ -5211,7 +5214,7 @@ gstd::value StgStageScript::Func_ObjShot_SetFixedAngle(gstd::script_machine* mac
 gstd::value StgStageScript::Func_ObjShot_SetSpinAngularVelocity(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	if (StgNormalShotObject* obj = dynamic_cast<StgNormalShotObject*>(script->GetObjectPointer(id))) {
+	if (StgNormalShotObject* obj = script->GetObjectPointerAs<StgNormalShotObject>(id)) {
 		double spin = argv[1].as_float();
 		obj->SetGraphicAngularVelocity(Math::DegreeToRadian(spin));
 	}
@@ -5220,7 +5223,7 @@ gstd::value StgStageScript::Func_ObjShot_SetSpinAngularVelocity(gstd::script_mac
 gstd::value StgStageScript::Func_ObjShot_SetDelayAngularVelocity(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	if (StgShotObject* obj = dynamic_cast<StgShotObject*>(script->GetObjectPointer(id))) {
+	if (StgShotObject* obj = script->GetObjectPointerAs<StgShotObject>(id)) {
 		double wvel = argv[1].as_float();
 		obj->SetDelayAngularVelocity(Math::DegreeToRadian(wvel));
 	}
@@ -6022,10 +6025,10 @@ gstd::value StgStageScript::Func_ObjItem_Regist(gstd::script_machine* machine, i
 gstd::value StgStageScript::Func_ObjItem_SetItemID(gstd::script_machine* machine, int argc, const gstd::value* argv) {
 	StgStageScript* script = (StgStageScript*)machine->data;
 	int id = argv[0].as_int();
-	StgItemObject_User* obj = script->GetObjectPointerAs<StgItemObject_User>(id);
-	if (obj) {
+	StgItemObject* obj = script->GetObjectPointerAs<StgItemObject>(id);
+	if (obj && obj->GetItemType() == StgItemObject::ITEM_USER) {
 		int id = argv[1].as_int();
-		obj->SetImageID(id);
+		((StgItemObject_User*)obj)->SetImageID(id);
 	}
 	return value();
 }
@@ -141,7 +141,10 @@ void StgSystemController::Work() {
 		if (infoSystem_->IsError()) {
 			std::wstring error = infoSystem_->GetErrorMessage();
 			if (error.size() > 0) {
-				ErrorDialog::ShowErrorDialog(error);
+				if (DnhConfiguration::GetInstance()->bHeadless_)
+					Logger::WriteTop(L"Headless: " + error);
+				else
+					ErrorDialog::ShowErrorDialog(error);
 			}
 			else {
 				bRetry = true;
@@ -160,6 +163,10 @@ void StgSystemController::Work() {
 		return;
 	}
 }
+bool StgSystemController::IsSeeking() {
+	if (infoSystem_->IsError() || infoSystem_->GetScene() != StgSystemInformation::SCENE_STG) return false;
+	return stageController_ != nullptr && stageController_->IsSeeking();
+}
 void StgSystemController::Render() {
 	if (infoSystem_->IsError()) return;
 
@@ -422,7 +429,7 @@ void StgSystemController::RenderScriptObject(int priMin, int priMax) {
 				}
 				if (pRenderListStage != nullptr && iPri < pRenderListStage->size()) {
 					for (auto itr = renderList.begin(); itr != renderList.end(); ++itr) {
-						if (DxScriptRenderObject* obj = dynamic_cast<DxScriptRenderObject*>(itr->get())) {
+						if (DxScriptRenderObject* obj = DxScriptObjectBase::CastTo<DxScriptRenderObject>(itr->get())) {
 							if (!bClearZBufferFor2DCoordinate)
 								bClearZBufferFor2DCoordinate = CheckMeshAndClearZBuffer(obj);
 							obj->Render();
@@ -464,7 +471,7 @@ void StgSystemController::RenderScriptObject(int priMin, int priMax) {
 
 				if (pRenderListPackage != nullptr && iPri < pRenderListPackage->size()) {
 					for (auto itr = renderList.begin(); itr != renderList.end(); ++itr) {
-						if (DxScriptRenderObject* obj = dynamic_cast<DxScriptRenderObject*>(itr->get())) {
+						if (DxScriptRenderObject* obj = DxScriptObjectBase::CastTo<DxScriptRenderObject>(itr->get())) {
 							if (!bClearZBufferFor2DCoordinate)
 								bClearZBufferFor2DCoordinate = CheckMeshAndClearZBuffer(obj);
 							obj->Render();
@@ -595,6 +602,8 @@ void StgSystemController::_ControlScene() {
 					scriptManager->OrphanAllScripts();
 				}
 			}
+			else if (DnhConfiguration::GetInstance()->bHeadless_)
+				infoSystem_->SetStgEnd();
 			else
 				TransStgEndScene();
 		}
@@ -53,6 +53,7 @@ public:
 
 	void Work();
 	void Render();
+	bool IsSeeking();
 
 	void RenderScriptObject();
 	void RenderScriptObject(int priMin, int priMax);
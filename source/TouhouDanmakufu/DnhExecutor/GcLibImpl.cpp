@@ -53,12 +53,18 @@ bool EApplication::_Initialize() {
 	config->windowTitle_ = appName;
 
 	ETextureManager* textureManager = ETextureManager::CreateInstance();
+	if (config->bTextureCache_) {
+		textureManager->SetImageCacheDirectory(PathProperty::GetModuleDirectory() + L"cache/texture/");
+		textureManager->SetImageCacheSizeMax(config->sizeTextureCacheMax_ * 1024ui64 * 1024ui64);
+	}
 	textureManager->Initialize();
 
 	EShaderManager* shaderManager = EShaderManager::CreateInstance();
 	shaderManager->Initialize();
 
 	EMeshManager* meshManager = EMeshManager::CreateInstance();
+	if (config->bMeshCache_)
+		meshManager->SetMeshCacheDirectory(PathProperty::GetModuleDirectory() + L"cache/mesh/");
 	meshManager->Initialize();
 
 	EDxTextRenderer* textRenderer = EDxTextRenderer::CreateInstance();
@@ -130,7 +136,11 @@ bool EApplication::_Loop() {
 
 	bWindowFocused_ = hWndFocused == hWndGraphics || hWndFocused == hWndLogger;
 	bool bInputEnable = false;
-	if (!config->bEnableUnfocusedProcessing_) {
+	if (config->bHeadless_) {
+		//Replay keys drive everything, real input is never read
+		bWindowFocused_ = true;
+	}
+	else if (!config->bEnableUnfocusedProcessing_) {
 		if (!bWindowFocused_) {
 			//Pause main thread when the window isn't focused
 			::Sleep(10);
@@ -145,7 +155,18 @@ bool EApplication::_Loop() {
 	{
 		static uint32_t count = 0;
 
-		auto& [bRenderFrame, bUpdateFrame] = fpsController->Advance();
+		//Headless or seeking a replay: run logic as fast as possible, never render
+		bool bSeeking = false;
+		for (const std::type_info* typeTask : { &typeid(EStgSystemController), &typeid(PStgSystemController) }) {
+			auto stgController = std::dynamic_pointer_cast<StgSystemController>(taskManager->GetTask(*typeTask));
+			if (stgController && stgController->IsSeeking()) {
+				bSeeking = true;
+				break;
+			}
+		}
+
+		auto [bRenderFrame, bUpdateFrame] = (config->bHeadless_ || bSeeking) ?
+			std::array<bool, 2>{ false, true } : fpsController->Advance();
 
 		if (bUpdateFrame) {
 			{
@@ -170,6 +191,8 @@ bool EApplication::_Loop() {
 					fpsController->GetCurrentWorkFps(),
 					fpsController->GetCurrentRenderFps());
 				logger->SetInfo(0, L"Fps", fps);
+				logger->SetInfo(3, L"Frame time", StringUtility::Format(L"p50: %.2fms, p99: %.2fms",
+					fpsController->GetFrameTimeP50(), fpsController->GetFrameTimeP99()));
 
 				{
 					const DirectGraphicsConfig& config = graphics->GetGraphicsConfig();
@@ -420,7 +443,7 @@ bool EDirectGraphics::Initialize(const std::wstring& windowTitle) {
 	DirectGraphicsConfig dxConfig;
 	dxConfig.sizeScreen = { screenWidth, screenHeight };
 	dxConfig.sizeScreenDisplay = { windowedWidth, windowedHeight };
-	dxConfig.bShowWindow = true;
+	dxConfig.bShowWindow = !dnhConfig->bHeadless_;
 	dxConfig.bShowCursor = dnhConfig->bMouseVisible_;
 	dxConfig.colorMode = dnhConfig->modeColor_;
 	dxConfig.bVSync = dnhConfig->bVSync_;
@@ -7,6 +7,11 @@
 //EStgSystemController
 //*******************************************************************
 void EStgSystemController::DoEnd() {
+    if (DnhConfiguration::GetInstance()->bHeadless_) {
+        EApplication::GetInstance()->End();
+        return;
+    }
+
     SystemController* systemController = SystemController::GetInstance();
     systemController->GetSceneManager()->TransScriptSelectScene_Last();
     systemController->ResetWindowTitle();
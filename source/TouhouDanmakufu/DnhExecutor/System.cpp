@@ -33,7 +33,10 @@ void SystemController::Reset() {
 
 	DnhConfiguration* config = DnhConfiguration::CreateInstance();
 	const std::wstring& pathPackageScript = config->pathPackageScript_;
-	if (pathPackageScript.size() == 0) {
+	if (config->bHeadless_) {
+		_StartHeadless();
+	}
+	else if (pathPackageScript.size() == 0) {
 		infoSystem_->UpdateFreePlayerScriptInformationList();
 		sceneManager_->TransTitleScene();
 	}
@@ -45,6 +48,36 @@ void SystemController::Reset() {
 			sceneManager_->TransPackageScene(info, true);
 	}
 }
+void SystemController::_StartHeadless() {
+	DnhConfiguration* config = DnhConfiguration::GetInstance();
+	const std::wstring& pathScript = config->pathHeadlessScript_;
+	const std::wstring& pathReplay = config->pathHeadlessReplay_;
+
+	Logger::WriteTop(StringUtility::Format(L"Headless: Running replay [%s]", pathReplay.c_str()));
+
+	ref_count_ptr<ScriptInformation> info = ScriptInformation::CreateScriptInformation(pathScript, false);
+	ref_count_ptr<ReplayInformation> replay = ReplayInformation::CreateFromFile(pathReplay);
+	if (info == nullptr || replay == nullptr) {
+		const std::wstring& pathMissing = info == nullptr ? pathScript : pathReplay;
+		Logger::WriteTop(L"Headless: " + ErrorUtility::GetFileNotFoundErrorMessage(pathMissing, true));
+		EApplication::GetInstance()->End();
+		return;
+	}
+
+	{
+		const std::wstring& pathReport = config->pathHeadlessReport_;
+		File::CreateFileDirectory(pathReport);
+
+		File file(pathReport);
+		if (file.Open(File::WRITEONLY)) {
+			std::string header = "stage,frame,hash,work_us\n";
+			file.Write(header.data(), (DWORD)header.size());
+		}
+	}
+
+	infoSystem_->UpdateFreePlayerScriptInformationList();
+	sceneManager_->TransStgScene(info, replay);
+}
 void SystemController::ClearTaskWithoutSystem() {
 	std::set<const std::type_info*> listInfo;
 	listInfo.insert(&typeid(SystemTransitionEffectTask));
@@ -54,6 +87,13 @@ void SystemController::ClearTaskWithoutSystem() {
 	taskManager->RemoveTaskWithoutTypeInfo(listInfo);
 }
 void SystemController::ShowErrorDialog(const std::wstring& msg) {
+	if (DnhConfiguration::GetInstance()->bHeadless_) {
+		//Nobody to close the dialog
+		Logger::WriteTop(L"Headless: " + msg);
+		EApplication::GetInstance()->End();
+		return;
+	}
+
 	HWND hParent = EDirectGraphics::GetInstance()->GetAttachedWindowHandle();
 	ErrorDialog dialog(hParent);
 	dialog.ShowModal(msg);
@@ -18,6 +18,8 @@ private:
 	ref_count_ptr<SceneManager> sceneManager_;
 	ref_count_ptr<TransitionManager> transitionManager_;
 	ref_count_ptr<SystemInformation> infoSystem_;
+
+	void _StartHeadless();
 public:
 	SystemController();
 	virtual ~SystemController();